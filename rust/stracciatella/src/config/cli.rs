@@ -108,6 +108,30 @@ impl Cli {
         opts.optflag("", "window", "Start the game in a window");
         opts.optflag("", "debug", "Enable Debug Mode");
         opts.optflag("", "enumgen", "Generate enums for Lua and exit");
+        opts.optopt(
+            "",
+            "record",
+            "Record the input of the session to a file, so it can be replayed",
+            "session.rec",
+        );
+        opts.optopt("", "replay", "Replay a recorded session and exit", "session.rec");
+        opts.optopt(
+            "",
+            "battle",
+            "Let the AI fight the battle of a saved game for all teams and exit",
+            "SAVENAME",
+        );
+        opts.optopt(
+            "",
+            "seed",
+            "Seed the random numbers with a fixed value, e.g. to repeat a battle",
+            "NUMBER",
+        );
+        opts.optflag(
+            "",
+            "headless",
+            "Run without showing the game or playing sound, requires -replay or -battle",
+        );
         opts.optflag("h", "help", "print this help menu");
 
         Cli {
@@ -216,6 +240,58 @@ impl Cli {
                     engine_options.run_enum_gen = true;
                 }
 
+                if let Some(s) = m.opt_str("record") {
+                    engine_options.input_record_file = PathBuf::from(s);
+                }
+
+                if let Some(s) = m.opt_str("replay") {
+                    if m.opt_present("record") {
+                        return Err(CliError::InvalidValue(
+                            "replay".to_owned(),
+                            "Cannot record and replay at the same time".to_owned(),
+                        ));
+                    }
+                    engine_options.input_replay_file = PathBuf::from(s);
+                }
+
+                if let Some(s) = m.opt_str("battle") {
+                    if m.opt_present("record") || m.opt_present("replay") {
+                        return Err(CliError::InvalidValue(
+                            "battle".to_owned(),
+                            "Cannot record or replay a battle".to_owned(),
+                        ));
+                    }
+                    engine_options.battle_save = s;
+                }
+
+                if let Some(s) = m.opt_str("seed") {
+                    if m.opt_present("replay") {
+                        return Err(CliError::InvalidValue(
+                            "seed".to_owned(),
+                            "A replay brings its own seed".to_owned(),
+                        ));
+                    }
+                    match s.parse::<u32>() {
+                        Ok(seed) => engine_options.random_seed = Some(seed),
+                        Err(_e) => {
+                            return Err(CliError::InvalidValue(
+                                "seed".to_owned(),
+                                "Should be an unsigned 32-bit integer.".to_owned(),
+                            ))
+                        }
+                    }
+                }
+
+                if m.opt_present("headless") {
+                    if !m.opt_present("replay") && !m.opt_present("battle") {
+                        return Err(CliError::InvalidValue(
+                            "headless".to_owned(),
+                            "Only a replay or a battle can run headless".to_owned(),
+                        ));
+                    }
+                    engine_options.run_headless = true;
+                }
+
                 Ok(())
             }
             Err(f) => Err(CliError::ParsingFailed(f.to_string())),
@@ -317,6 +393,82 @@ mod tests {
         assert_eq!(engine_options.mods[1], "ö");
     }
 
+    #[test]
+    fn apply_to_engine_options_should_be_able_to_replay_headless() {
+        let mut engine_options = EngineOptions::default();
+        let input = Cli::from_args(&[
+            String::from("ja2"),
+            String::from("-replay"),
+            String::from("session.rec"),
+            String::from("-headless"),
+        ]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut engine_options).err(),
+            None
+        );
+        assert_eq!(engine_options.input_replay_file, PathBuf::from("session.rec"));
+        assert!(engine_options.run_headless);
+
+        let input = Cli::from_args(&[String::from("ja2"), String::from("-headless")]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut engine_options).err(),
+            Some(CliError::InvalidValue(
+                "headless".to_owned(),
+                "Only a replay or a battle can run headless".to_owned()
+            ))
+        );
+    }
+
+    #[test]
+    fn apply_to_engine_options_should_be_able_to_run_a_battle() {
+        let mut engine_options = EngineOptions::default();
+        let input = Cli::from_args(&[
+            String::from("ja2"),
+            String::from("-battle"),
+            String::from("Drassen airport"),
+            String::from("-headless"),
+        ]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut engine_options).err(),
+            None
+        );
+        assert_eq!(engine_options.battle_save, "Drassen airport");
+        assert!(engine_options.run_headless);
+        assert_eq!(engine_options.random_seed, None);
+    }
+
+    #[test]
+    fn apply_to_engine_options_should_be_able_to_seed_a_battle() {
+        let mut engine_options = EngineOptions::default();
+        let input = Cli::from_args(&[
+            String::from("ja2"),
+            String::from("-battle"),
+            String::from("Drassen airport"),
+            String::from("-seed"),
+            String::from("1234"),
+        ]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut engine_options).err(),
+            None
+        );
+        assert_eq!(engine_options.random_seed, Some(1234));
+
+        let input = Cli::from_args(&[
+            String::from("ja2"),
+            String::from("-replay"),
+            String::from("session.rec"),
+            String::from("-seed"),
+            String::from("1234"),
+        ]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut EngineOptions::default()).err(),
+            Some(CliError::InvalidValue(
+                "seed".to_owned(),
+                "A replay brings its own seed".to_owned()
+            ))
+        );
+    }
+
     #[test]
     fn apply_to_engine_options_should_fail_with_unknown_resversion() {
         let mut engine_options = EngineOptions::default();
@@ -81,6 +81,16 @@ pub struct EngineOptions {
     pub start_without_sound: bool,
     /// Whether to enum-gen for Lua
     pub run_enum_gen: bool,
+    /// File to record the input of the session to, empty if not recording
+    pub input_record_file: PathBuf,
+    /// Recorded session to replay, empty if not replaying
+    pub input_replay_file: PathBuf,
+    /// Saved game whose battle the AI fights for all teams, empty if none
+    pub battle_save: String,
+    /// Fixed seed for the random numbers, a fresh one is used if none
+    pub random_seed: Option<u32>,
+    /// Whether to run without showing the game or playing sound
+    pub run_headless: bool,
 }
 
 impl Default for EngineOptions {
@@ -103,6 +113,11 @@ impl Default for EngineOptions {
             start_in_debug_mode: false,
             start_without_sound: false,
             run_enum_gen: false,
+            input_record_file: PathBuf::from(""),
+            input_replay_file: PathBuf::from(""),
+            battle_save: String::new(),
+            random_seed: None,
+            run_headless: false,
         }
     }
 }
@@ -57,6 +57,7 @@
 //! [(faq/casemap_charprop.html#2)]: http://unicode.org/faq/casemap_charprop.html#2
 #![allow(dead_code)]
 
+use std::borrow::Borrow;
 use std::fmt;
 use std::ops;
 
@@ -116,6 +117,14 @@ impl AsRef<str> for Nfc {
     }
 }
 
+/// Allows looking up `Nfc` keys with a `&str`.
+/// The derived `Hash`, `Eq` and `Ord` only use the inner string, so they match `str`.
+impl Borrow<str> for Nfc {
+    fn borrow(&self) -> &str {
+        &self.inner
+    }
+}
+
 impl From<&str> for Nfc {
     fn from(s: &str) -> Self {
         Self::from(s.to_owned())
@@ -1,28 +1,27 @@
-//! This module contains a virtual filesystem backed by a SLF file.
+//! This module contains a virtual filesystem backed by Android assets.
 #![allow(dead_code)]
 
 use std::collections::HashSet;
-use std::ffi::CString;
-use std::ffi::OsString;
+use std::ffi::{CString, OsString};
 use std::fmt;
+use std::fs::File;
 use std::io;
 use std::io::SeekFrom;
-use std::num::NonZeroUsize;
+use std::os::unix::ffi::OsStrExt;
+use std::os::unix::fs::FileExt;
+use std::os::unix::io::FromRawFd;
 use std::path::{Path, PathBuf};
 use std::sync::Arc;
 use std::sync::Mutex;
 
-use lru::LruCache;
 use ndk::asset::{Asset, AssetManager};
 use send_wrapper::SendWrapper;
 
 use crate::android::get_asset_manager;
 use crate::unicode::Nfc;
+use crate::vfs::asset_index::{AssetIndex, AssetKind, AssetSource};
 use crate::vfs::{VfsFile, VfsLayer};
 
-/// The size of the cache used for canonicalization
-const CANONICALIZATION_CACHE_SIZE: usize = 256;
-
 /// A case-insensitive virtual filesystem backed by a filesystem directory.
 #[derive(Debug)]
 pub struct AssetManagerFs {
@@ -30,8 +29,8 @@ pub struct AssetManagerFs {
     pub base_path: PathBuf,
     /// A local reference to the android asset manager
     asset_manager: AssetManager,
-    /// Cache that is used for canonicalization. It will contain an entry for each path that is listed during path canonicalization
-    canonicalization_cache: Mutex<LruCache<PathBuf, Vec<(Nfc, OsString)>>>,
+    /// Index of all assets below the base path, built once on creation
+    index: AssetIndex,
 }
 
 /// A virtual file.
@@ -41,8 +40,56 @@ pub struct AssetManagerFsFile {
     pub file_path: Nfc,
     /// Display info.
     pub base_path: PathBuf,
-    /// Asset that is open.
-    pub file: Arc<Mutex<SendWrapper<Asset>>>,
+    /// Where the data of the asset is read from.
+    data: AssetData,
+}
+
+/// Data of an open asset
+#[derive(Debug)]
+enum AssetData {
+    /// An uncompressed asset, read directly from its range of the APK
+    Descriptor {
+        file: File,
+        offset: u64,
+        len: u64,
+        position: u64,
+    },
+    /// A compressed asset, read through the asset manager
+    Asset(Arc<Mutex<SendWrapper<Asset>>>),
+}
+
+/// Lists asset directories for the index
+struct ApkAssetSource<'a> {
+    asset_manager: &'a AssetManager,
+}
+
+impl AssetSource for ApkAssetSource<'_> {
+    fn list_dir(&self, dir: &Path) -> io::Result<Vec<(OsString, AssetKind)>> {
+        // The native listing only contains the files, the JNI listing also the directories
+        let dir_cstring = AssetManagerFs::path_to_cstring(dir)?;
+        let files: HashSet<Vec<u8>> = match self.asset_manager.open_dir(&dir_cstring) {
+            Some(asset_dir) => asset_dir.map(CString::into_bytes).collect(),
+            None => HashSet::new(),
+        };
+        let entries = crate::android::list_asset_dir(dir).map_err(|e| {
+            io::Error::new(
+                io::ErrorKind::Other,
+                format!("AssetManagerFs: JNI Error: `{:?}`", e),
+            )
+        })?;
+
+        Ok(entries
+            .into_iter()
+            .map(|name| {
+                let kind = if files.contains(name.as_os_str().as_bytes()) {
+                    AssetKind::File
+                } else {
+                    AssetKind::Dir
+                };
+                (name.into_os_string(), kind)
+            })
+            .collect())
+    }
 }
 
 impl AssetManagerFs {
@@ -64,86 +111,39 @@ impl AssetManagerFs {
                 format!("AssetManagerFs: Error testing base path `{:?}`", base_path),
             )
         })?;
+        let index = AssetIndex::build(
+            &ApkAssetSource {
+                asset_manager: &asset_manager,
+            },
+            base_path,
+        )?;
         Ok(Arc::new(AssetManagerFs {
             base_path: base_path.to_owned(),
             asset_manager,
-            canonicalization_cache: Mutex::new(LruCache::new(
-                NonZeroUsize::new(CANONICALIZATION_CACHE_SIZE).unwrap(),
-            )),
+            index,
         }))
     }
 
-    /// Maps a path to all candidates that might match the path case insensitively
-    ///
-    /// The returned paths are already containing the base path
-    fn canonicalize(&self, file_path: &str) -> io::Result<Vec<PathBuf>> {
-        let mut candidates = vec![self.base_path.to_owned()];
-        let mut canonicalization_cache = self.canonicalization_cache.lock().map_err(|err| {
-            io::Error::new(
-                io::ErrorKind::Other,
-                format!(
-                    "AssetManagerFs: Error locking canonicalization cache: `{}`",
-                    err
-                ),
-            )
-        })?;
-
-        if file_path.is_empty() {
-            return Ok(candidates);
+    /// Opens an asset, directly from the APK if it is stored uncompressed
+    fn open_asset(&self, path: &Path) -> io::Result<Option<AssetData>> {
+        let path_cstring = Self::path_to_cstring(path)?;
+        let asset = match self.asset_manager.open(&path_cstring) {
+            Some(asset) => asset,
+            None => return Ok(None),
+        };
+        if let Some(descriptor) = asset.open_file_descriptor() {
+            // The descriptor is our own and stays valid after the asset is closed
+            let file = unsafe { File::from_raw_fd(descriptor.fd) };
+            return Ok(Some(AssetData::Descriptor {
+                file,
+                offset: descriptor.offset as u64,
+                len: descriptor.size as u64,
+                position: 0,
+            }));
         }
-
-        for want in file_path.split('/') {
-            let mut next = Vec::new();
-            if want == "." || want == ".." {
-                return Err(io::Error::new(
-                    io::ErrorKind::InvalidInput,
-                    "AssetManagerFs: Special path components are not supported",
-                ));
-            }
-            for candidate in candidates {
-                let candidate_cstring = Self::path_to_cstring(&candidate)?;
-                let entries = if let Some(cache_entry) = canonicalization_cache.get(&candidate) {
-                    cache_entry
-                } else if self.asset_manager.open_dir(&candidate_cstring).is_none() {
-                    canonicalization_cache.put(candidate.clone(), vec![]);
-                    canonicalization_cache
-                        .get(&candidate)
-                        .expect("we should be able to get a cache key that was just set")
-                } else {
-                    let entries: Vec<_> = crate::android::list_asset_dir(&candidate)
-                        .map_err(|e| {
-                            io::Error::new(
-                                io::ErrorKind::Other,
-                                format!("AssetManagerFs: JNI Error: `{:?}`", e),
-                            )
-                        })?
-                        .iter()
-                        .flat_map(|path_buf| {
-                            path_buf
-                                .to_str()
-                                .map(|s| (Nfc::caseless(s), path_buf.into()))
-                        })
-                        .collect();
-                    canonicalization_cache.put(candidate.clone(), entries);
-                    canonicalization_cache
-                        .get(&candidate)
-                        .expect("we should be able to get a cache key that was just set")
-                };
-
-                for (nfc, os_string) in entries {
-                    if want == nfc.as_str() {
-                        next.push(candidate.join(&os_string));
-                    }
-                }
-            }
-            candidates = next;
-            if candidates.is_empty() {
-                break;
-            }
-        }
-        candidates.sort();
-
-        Ok(candidates)
+        Ok(Some(AssetData::Asset(Arc::new(Mutex::new(
+            SendWrapper::new(asset),
+        )))))
     }
 
     /// Maps a path to CString for asset manager
@@ -175,15 +175,12 @@ impl AssetManagerFs {
 
 impl VfsLayer for AssetManagerFs {
     fn open(&self, file_path: &Nfc) -> io::Result<Box<dyn VfsFile>> {
-        let candidates = self.canonicalize(file_path)?;
-
-        for candidate in candidates {
-            let candidate_cstring = Self::path_to_cstring(&candidate)?;
-            if let Some(file) = self.asset_manager.open(&candidate_cstring) {
+        for candidate in self.index.resolve(file_path)? {
+            if let Some(data) = self.open_asset(&self.base_path.join(candidate))? {
                 return Ok(Box::new(AssetManagerFsFile {
                     file_path: file_path.clone(),
                     base_path: self.base_path.clone(),
-                    file: Arc::new(Mutex::new(SendWrapper::new(file))),
+                    data,
                 }));
             }
         }
@@ -199,39 +196,23 @@ impl VfsLayer for AssetManagerFs {
 
     fn read_dir(&self, file_path: &Nfc) -> io::Result<HashSet<Nfc>> {
         let file_path = file_path.trim_end_matches('/');
-        let candidates = self.canonicalize(file_path)?;
-        let mut result = HashSet::new();
-
-        for candidate in candidates {
-            let dir_contents = crate::android::list_asset_dir(&candidate).map_err(|e| {
-                io::Error::new(
-                    io::ErrorKind::Other,
-                    format!("AssetManagerFs: JNI Error: `{:?}`", e),
-                )
-            })?;
-
-            for file_name in dir_contents {
-                let file_name_nfc = Nfc::caseless_path(
-                    &file_name.into_os_string().into_string().map_err(|err| {
-                        io::Error::new(
-                            io::ErrorKind::InvalidInput,
-                            format!("Could not convert path to NFC for AssetManager: {:?}", err),
-                        )
-                    })?,
-                );
-                result.insert(file_name_nfc);
-            }
-        }
+        // Rejects special path components like opening does
+        self.index.resolve(file_path)?;
 
-        Ok(result)
+        Ok(self.index.read_dir(file_path).cloned().unwrap_or_default())
     }
 }
 
 impl VfsFile for AssetManagerFsFile {
     /// Gets the length of the file.
     fn len(&self) -> io::Result<u64> {
-        let file = self.file.lock().expect("android asset file");
-        Ok(file.get_length() as u64)
+        match &self.data {
+            AssetData::Descriptor { len, .. } => Ok(*len),
+            AssetData::Asset(asset) => {
+                let asset = asset.lock().expect("android asset file");
+                Ok(asset.get_length() as u64)
+            }
+        }
     }
 }
 
@@ -253,15 +234,54 @@ impl fmt::Display for AssetManagerFsFile {
 
 impl io::Read for AssetManagerFsFile {
     fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
-        let mut file = self.file.lock().expect("android asset file");
-        file.read(buf)
+        match &mut self.data {
+            AssetData::Descriptor {
+                file,
+                offset,
+                len,
+                position,
+            } => {
+                let remaining = len.saturating_sub(*position);
+                let count = std::cmp::min(buf.len() as u64, remaining) as usize;
+                let read = file.read_at(&mut buf[..count], *offset + *position)?;
+                *position += read as u64;
+                Ok(read)
+            }
+            AssetData::Asset(asset) => {
+                let mut asset = asset.lock().expect("android asset file");
+                asset.read(buf)
+            }
+        }
     }
 }
 
 impl io::Seek for AssetManagerFsFile {
     fn seek(&mut self, pos: SeekFrom) -> io::Result<u64> {
-        let mut file = self.file.lock().expect("android asset file");
-        file.seek(pos)
+        match &mut self.data {
+            AssetData::Descriptor { len, position, .. } => {
+                let (base, delta) = match pos {
+                    SeekFrom::Start(p) => (p, 0),
+                    SeekFrom::End(p) => (*len, p),
+                    SeekFrom::Current(p) => (*position, p),
+                };
+                let new_position = if delta < 0 {
+                    base.checked_sub(delta.unsigned_abs())
+                } else {
+                    base.checked_add(delta as u64)
+                };
+                *position = new_position.ok_or_else(|| {
+                    io::Error::new(
+                        io::ErrorKind::InvalidInput,
+                        "AssetManagerFsFile: Seek to a negative position",
+                    )
+                })?;
+                Ok(*position)
+            }
+            AssetData::Asset(asset) => {
+                let mut asset = asset.lock().expect("android asset file");
+                asset.seek(pos)
+            }
+        }
     }
 }
 
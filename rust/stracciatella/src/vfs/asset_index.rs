@@ -0,0 +1,182 @@
+//! This module contains a case-insensitive index of a read-only directory tree.
+//!
+//! Listing Android asset directories takes a JNI round-trip, so the asset
+//! filesystem lists every directory once when it is created and resolves
+//! paths and directory listings from the index afterwards.
+
+use std::collections::{HashMap, HashSet};
+use std::ffi::OsString;
+use std::io;
+use std::path::{Path, PathBuf};
+
+use crate::unicode::Nfc;
+
+/// Kind of an entry in an asset directory
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum AssetKind {
+    File,
+    Dir,
+}
+
+/// A source of assets that can list its directories
+pub trait AssetSource {
+    /// Lists the names and kinds of the entries of a directory
+    fn list_dir(&self, dir: &Path) -> io::Result<Vec<(OsString, AssetKind)>>;
+}
+
+/// Case-insensitive index of all files and directories below a base path.
+#[derive(Debug, Default)]
+pub struct AssetIndex {
+    /// Actual paths relative to the base path by caseless path, sorted
+    paths: HashMap<Nfc, Vec<PathBuf>>,
+    /// Caseless entry names of the directories by caseless path
+    dirs: HashMap<Nfc, HashSet<Nfc>>,
+}
+
+impl AssetIndex {
+    /// Builds the index by listing every directory below the base path once
+    pub fn build(source: &dyn AssetSource, base_path: &Path) -> io::Result<AssetIndex> {
+        let mut index = AssetIndex::default();
+        let mut pending = vec![(PathBuf::new(), Nfc::caseless(""))];
+
+        while let Some((dir, caseless_dir)) = pending.pop() {
+            let entries = source.list_dir(&base_path.join(&dir))?;
+            for (name, kind) in entries {
+                let name_str = name.to_str().ok_or_else(|| {
+                    io::Error::new(
+                        io::ErrorKind::InvalidInput,
+                        format!("AssetIndex: Could not convert asset name {:?}", name),
+                    )
+                })?;
+                let caseless_name = Nfc::caseless_path(name_str);
+                let caseless_path = if caseless_dir.is_empty() {
+                    caseless_name.clone()
+                } else {
+                    caseless_dir.clone() + "/" + caseless_name.as_str()
+                };
+                let path = dir.join(&name);
+
+                index
+                    .dirs
+                    .entry(caseless_dir.clone())
+                    .or_default()
+                    .insert(caseless_name);
+                index
+                    .paths
+                    .entry(caseless_path.clone())
+                    .or_default()
+                    .push(path.clone());
+                if kind == AssetKind::Dir {
+                    index.dirs.entry(caseless_path.clone()).or_default();
+                    pending.push((path, caseless_path));
+                }
+            }
+        }
+        for paths in index.paths.values_mut() {
+            paths.sort();
+        }
+
+        Ok(index)
+    }
+
+    /// Maps a caseless path to the actual paths relative to the base path that match it
+    pub fn resolve(&self, file_path: &str) -> io::Result<&[PathBuf]> {
+        if file_path.split('/').any(|c| c == "." || c == "..") {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidInput,
+                "AssetIndex: Special path components are not supported",
+            ));
+        }
+        Ok(self
+            .paths
+            .get(file_path)
+            .map(|paths| paths.as_slice())
+            .unwrap_or_default())
+    }
+
+    /// Returns the caseless entry names of a directory, `None` if it is not a directory
+    pub fn read_dir(&self, dir_path: &str) -> Option<&HashSet<Nfc>> {
+        self.dirs.get(dir_path)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use std::cell::Cell;
+
+    use super::*;
+
+    /// Asset source with a fixed list of files that counts its listings
+    struct MockAssetSource {
+        files: Vec<PathBuf>,
+        listings: Cell<usize>,
+    }
+
+    impl MockAssetSource {
+        fn new(files: &[&str]) -> MockAssetSource {
+            MockAssetSource {
+                files: files.iter().map(|f| Path::new("assets").join(f)).collect(),
+                listings: Cell::new(0),
+            }
+        }
+    }
+
+    impl AssetSource for MockAssetSource {
+        fn list_dir(&self, dir: &Path) -> io::Result<Vec<(OsString, AssetKind)>> {
+            self.listings.set(self.listings.get() + 1);
+            let mut entries = vec![];
+            for file in &self.files {
+                if let Ok(rest) = file.strip_prefix(dir) {
+                    let mut components = rest.components();
+                    let name = components.next().unwrap().as_os_str().to_owned();
+                    let kind = if components.next().is_some() {
+                        AssetKind::Dir
+                    } else {
+                        AssetKind::File
+                    };
+                    if !entries.contains(&(name.clone(), kind)) {
+                        entries.push((name, kind));
+                    }
+                }
+            }
+            Ok(entries)
+        }
+    }
+
+    #[test]
+    fn build_should_list_every_directory_once() {
+        let source = MockAssetSource::new(&["a.json", "maps/a.dat", "maps/b.dat", "tiles/x/y.sti"]);
+        AssetIndex::build(&source, Path::new("assets")).unwrap();
+
+        assert_eq!(source.listings.get(), 4);
+    }
+
+    #[test]
+    fn resolve_should_match_case_insensitively() {
+        let source = MockAssetSource::new(&["Data/Foo.json", "data/foo.JSON", "Data/bar.json"]);
+        let index = AssetIndex::build(&source, Path::new("assets")).unwrap();
+
+        assert_eq!(
+            index.resolve("data/foo.json").unwrap(),
+            &[PathBuf::from("Data/Foo.json"), PathBuf::from("data/foo.JSON")]
+        );
+        assert_eq!(
+            index.resolve("data").unwrap(),
+            &[PathBuf::from("Data"), PathBuf::from("data")]
+        );
+        assert!(index.resolve("data/baz.json").unwrap().is_empty());
+        assert!(index.resolve("data/../foo.json").is_err());
+    }
+
+    #[test]
+    fn read_dir_should_list_caseless_names() {
+        let source = MockAssetSource::new(&["Data/Foo.json", "data/Sub/bar.json", "Top.txt"]);
+        let index = AssetIndex::build(&source, Path::new("assets")).unwrap();
+
+        let expected: HashSet<_> = ["foo.json", "sub"].iter().map(|s| Nfc::caseless(s)).collect();
+        assert_eq!(index.read_dir("data"), Some(&expected));
+        let expected: HashSet<_> = ["data", "top.txt"].iter().map(|s| Nfc::caseless(s)).collect();
+        assert_eq!(index.read_dir(""), Some(&expected));
+        assert_eq!(index.read_dir("top.txt"), None);
+    }
+}
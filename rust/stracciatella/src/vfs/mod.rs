@@ -6,6 +6,7 @@
 
 #[cfg(target_os = "android")]
 pub mod android;
+pub mod asset_index;
 pub mod dir;
 pub mod slf;
 
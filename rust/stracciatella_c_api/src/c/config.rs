@@ -318,6 +318,51 @@ pub extern "C" fn EngineOptions_shouldRunEnumGen(ptr: *const EngineOptions) -> b
     engine_options.run_enum_gen
 }
 
+/// Gets the `EngineOptions.input_record_file` path, empty if the session is not recorded.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getInputRecordFile(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    c_string_from_path_or_panic(&engine_options.input_record_file).into_raw()
+}
+
+/// Gets the `EngineOptions.input_replay_file` path, empty if no session is replayed.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getInputReplayFile(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    c_string_from_path_or_panic(&engine_options.input_replay_file).into_raw()
+}
+
+/// Gets the `EngineOptions.battle_save` name, empty if no battle is simulated.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getBattleSave(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    c_string_from_str(&engine_options.battle_save).into_raw()
+}
+
+/// Gets whether `EngineOptions.random_seed` is set.
+#[no_mangle]
+pub extern "C" fn EngineOptions_hasRandomSeed(ptr: *const EngineOptions) -> bool {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.random_seed.is_some()
+}
+
+/// Gets `EngineOptions.random_seed`, 0 if it is not set.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getRandomSeed(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.random_seed.unwrap_or(0)
+}
+
+/// Gets `EngineOptions.run_headless`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_shouldRunHeadless(ptr: *const EngineOptions) -> bool {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.run_headless
+}
+
 /// Gets the string representation of the `ScalingQuality` value.
 /// The caller is responsible for the returned memory.
 #[no_mangle]
@@ -3,7 +3,11 @@ use std::collections::BTreeMap;
 use serde_json::Value;
 use stracciatella::json::de;
 
-use super::{common::*, vec::VecCString};
+use super::{
+    common::*,
+    str_view::{intern, RStrView},
+    vec::VecCString,
+};
 
 #[derive(Debug, Clone)]
 pub struct RJsonValue(pub Value);
@@ -40,7 +44,7 @@ impl RJsonValue {
             .map(|obj| {
                 RJsonObject(
                     obj.iter()
-                        .map(|(k, v)| (k.clone(), RJsonValue(v.clone())))
+                        .map(|(k, v)| (intern(k), RJsonValue(v.clone())))
                         .collect(),
                 )
             })
@@ -80,9 +84,12 @@ impl RJsonValue {
     }
 
     fn to_string(&self) -> Result<String, String> {
+        self.as_str().map(|s| s.to_string())
+    }
+
+    fn as_str(&self) -> Result<&str, String> {
         self.0
             .as_str()
-            .map(|s| s.to_string())
             .ok_or_else(|| "expected string".to_string())
     }
 
@@ -121,16 +128,22 @@ impl RJsonArray {
     }
 }
 
+/// A json object for C.
+/// The keys are interned, the same keys repeat in thousands of objects of the same kind.
 #[derive(Debug, Clone, Default)]
-pub struct RJsonObject(BTreeMap<String, RJsonValue>);
+pub struct RJsonObject(BTreeMap<&'static str, RJsonValue>);
 
 impl RJsonObject {
     fn get(&self, prop: &str) -> Option<RJsonValue> {
         self.0.get(prop).cloned()
     }
 
+    fn get_ref(&self, prop: &str) -> Option<&RJsonValue> {
+        self.0.get(prop)
+    }
+
     fn set(&mut self, prop: &str, value: &RJsonValue) {
-        self.0.insert(prop.to_string(), value.clone());
+        self.0.insert(intern(prop), value.clone());
     }
 
     fn keys(&self) -> VecCString {
@@ -146,7 +159,7 @@ impl RJsonObject {
         RJsonValue(Value::Object(
             self.0
                 .iter()
-                .map(|(k, v)| (k.clone(), v.0.clone()))
+                .map(|(k, v)| (k.to_string(), v.0.clone()))
                 .collect(),
         ))
     }
@@ -240,6 +253,21 @@ pub extern "C" fn RJsonValue_toString(value: *const RJsonValue) -> *mut c_char {
     }
 }
 
+/// Borrows the string of the JsonValue without copying it.
+/// The view is valid until the value is destroyed.
+/// Returns a null view and sets the rust error if the value is not a string.
+#[no_mangle]
+pub extern "C" fn RJsonValue_toStrView(value: *const RJsonValue) -> RStrView {
+    let value = unsafe_ref(value);
+    match value.as_str() {
+        Ok(s) => RStrView::from_str(s),
+        Err(e) => {
+            remember_rust_error(e);
+            RStrView::null()
+        }
+    }
+}
+
 macro_rules! is_type {
     ($value:expr, $fn:ident) => {{
         let value = unsafe_ref($value);
@@ -413,6 +441,26 @@ pub extern "C" fn RJsonObject_get(obj: *const RJsonObject, prop: *const c_char)
     }
 }
 
+/// Borrows a string property of the object without copying the value.
+/// The view is valid until the object is modified or destroyed.
+/// Returns a null view and sets the rust error if the property is missing or not a string.
+#[no_mangle]
+pub extern "C" fn RJsonObject_getStrView(obj: *const RJsonObject, prop: *const c_char) -> RStrView {
+    let obj = unsafe_ref(obj);
+    let prop = str_from_c_str_or_panic(unsafe_c_str(prop));
+    let result = obj
+        .get_ref(prop)
+        .ok_or_else(|| format!("failed to get property {}", prop))
+        .and_then(|val| val.as_str());
+    match result {
+        Ok(s) => RStrView::from_str(s),
+        Err(e) => {
+            remember_rust_error(e);
+            RStrView::null()
+        }
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn RJsonObject_set(
     obj: *mut RJsonObject,
@@ -6,6 +6,7 @@ pub use stracciatella::logger::LogLevel;
 use stracciatella::logger::Logger;
 
 use crate::c::common::*;
+use crate::c::str_view::RStrView;
 
 /// Initializes the logger
 #[no_mangle]
@@ -35,9 +36,10 @@ pub extern "C" fn Logger_getLevel() -> LogLevel {
 }
 
 /// Log with custom metadata
+/// The message is borrowed, so formatted messages don't need to be terminated or copied.
 #[no_mangle]
-pub extern "C" fn Logger_log(level: LogLevel, message: *const c_char, target: *const c_char) {
-    let message = str_from_c_str_or_panic(unsafe_c_str(message));
+pub extern "C" fn Logger_log(level: LogLevel, message: RStrView, target: *const c_char) {
+    let message = message.as_str_or_panic();
     let target = str_from_c_str_or_panic(unsafe_c_str(target));
 
     Logger::log_with_custom_metadata(level, message, target);
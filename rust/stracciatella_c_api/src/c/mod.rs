@@ -11,6 +11,7 @@ pub mod misc;
 pub mod mod_manager;
 pub mod path;
 pub mod schema_manager;
+pub mod str_view;
 pub mod subprocess;
 pub mod vec;
 pub mod vfs;
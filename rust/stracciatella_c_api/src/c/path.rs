@@ -3,12 +3,28 @@
 //! [`std::path`]: https://doc.rust-lang.org/std/path/index.html
 
 use std::convert::TryFrom;
-use std::ffi::CString;
+use std::ffi::{CString, OsStr};
+use std::path::Path;
 use std::ptr;
 use std::usize;
 
 use crate::any_path::AnyPath;
 use crate::c::common::*;
+use crate::c::str_view::RStrView;
+
+/// Borrows a component of an encoded path.
+/// Encoding never touches separators or dots, so the component of the encoded path is the
+/// encoded component and can point into the original string.
+fn encoded_component_view(
+    path: RStrView,
+    component: impl Fn(&Path) -> Option<&OsStr>,
+) -> RStrView {
+    let path = Path::new(path.as_str_or_panic());
+    match component(path).and_then(|c| c.to_str()) {
+        Some(c) => RStrView::from_str(c),
+        None => RStrView::null(),
+    }
+}
 
 /// Encodes a `[u8]` path.
 /// Returns the encoded path.
@@ -70,6 +86,27 @@ pub extern "C" fn Path_filename(path: *const c_char) -> *mut c_char {
     }
 }
 
+/// Borrows the extension of the path, the view points into `path`.
+/// Returns a null view if there is no extension.
+#[no_mangle]
+pub extern "C" fn Path_extensionView(path: RStrView) -> RStrView {
+    encoded_component_view(path, |p| p.extension())
+}
+
+/// Borrows the filename of the path, the view points into `path`.
+/// Returns a null view if there is no filename.
+#[no_mangle]
+pub extern "C" fn Path_filenameView(path: RStrView) -> RStrView {
+    encoded_component_view(path, |p| p.file_name())
+}
+
+/// Borrows the filestem of the path, the view points into `path`.
+/// Returns a null view if there is no filestem.
+#[no_mangle]
+pub extern "C" fn Path_filestemView(path: RStrView) -> RStrView {
+    encoded_component_view(path, |p| p.file_stem())
+}
+
 /// Gets the filestem of the path.
 /// Returns null if there is no filestem.
 #[no_mangle]
@@ -0,0 +1,127 @@
+//! This module contains borrowed strings and a string interner for C.
+//!
+//! A [`RStrView`] is a pointer and a length without a nul terminator. It never owns the memory,
+//! the side that hands it out decides how long it stays valid:
+//!  * views passed into a function are only valid for the duration of the call
+//!  * views returned by a function borrow from the object they were taken from and are
+//!    invalidated by modifying or destroying that object
+//!
+//! Strings returned by [`intern`] stay valid until the program exits.
+//!
+//! [`RStrView`]: struct.RStrView.html
+//! [`intern`]: fn.intern.html
+
+use std::collections::HashSet;
+use std::ptr;
+use std::slice;
+use std::str;
+use std::sync::Mutex;
+
+use lazy_static::lazy_static;
+
+use crate::c::common::*;
+
+/// A borrowed string that is not nul terminated.
+/// An empty view may have a null data pointer.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct RStrView {
+    pub data: *const c_char,
+    pub len: usize,
+}
+
+impl RStrView {
+    /// A view that points to nothing.
+    pub fn null() -> Self {
+        RStrView {
+            data: ptr::null(),
+            len: 0,
+        }
+    }
+
+    /// Borrows the bytes of the string, the view must not outlive it.
+    pub fn from_str(s: &str) -> Self {
+        RStrView {
+            data: s.as_ptr() as *const c_char,
+            len: s.len(),
+        }
+    }
+
+    /// Returns true if the view does not point anywhere.
+    pub fn is_null(&self) -> bool {
+        self.data.is_null()
+    }
+
+    /// Gets the bytes of the view.
+    pub fn as_bytes<'a>(&self) -> &'a [u8] {
+        if self.len == 0 {
+            return &[];
+        }
+        assert!(!self.data.is_null());
+        unsafe { slice::from_raw_parts(self.data as *const u8, self.len) }
+    }
+
+    /// Gets the view as a str. Panics if it is not valid utf8.
+    pub fn as_str_or_panic<'a>(&self) -> &'a str {
+        let bytes = self.as_bytes();
+        match str::from_utf8(bytes) {
+            Ok(s) => s,
+            Err(e) => panic!("Converting {:?} to str: {:?}", bytes, e),
+        }
+    }
+}
+
+lazy_static! {
+    /// The strings known to the interner. They are leaked on purpose so views of them never dangle.
+    static ref INTERNED_STRINGS: Mutex<HashSet<&'static str>> = Mutex::new(HashSet::new());
+}
+
+/// Returns the shared copy of the string, creating it the first time it is seen.
+/// Meant for identifiers that repeat a lot, such as json keys and item names.
+/// Equal strings always get the same data pointer, so they can be compared by address.
+pub fn intern(s: &str) -> &'static str {
+    let mut strings = INTERNED_STRINGS.lock().unwrap();
+    if let Some(interned) = strings.get(s) {
+        return interned;
+    }
+    let interned: &'static str = Box::leak(s.to_owned().into_boxed_str());
+    strings.insert(interned);
+    interned
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn views() {
+        let s = "abc\0def";
+        let view = RStrView::from_str(s);
+        assert_eq!(view.len, 7);
+        assert_eq!(view.as_str_or_panic(), s);
+        assert!(RStrView::null().is_null());
+        assert_eq!(RStrView::null().as_str_or_panic(), "");
+    }
+
+    #[test]
+    #[should_panic]
+    fn invalid_utf8_view() {
+        let bytes = b"12\xe1";
+        let view = RStrView {
+            data: bytes.as_ptr() as *const c_char,
+            len: bytes.len(),
+        };
+        view.as_str_or_panic();
+    }
+
+    #[test]
+    fn interning() {
+        let first = intern("GLOCK_17");
+        let owned = String::from("GLOCK_17");
+        let second = intern(&owned);
+        let other = intern("GLOCK_18");
+        assert_eq!(first.as_ptr(), second.as_ptr());
+        assert_ne!(first.as_ptr(), other.as_ptr());
+        assert_eq!(second, "GLOCK_17");
+    }
+}
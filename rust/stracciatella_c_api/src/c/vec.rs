@@ -5,6 +5,7 @@
 use std::ffi::CString;
 
 use crate::c::common::*;
+use crate::c::str_view::RStrView;
 
 /// A wrapper around `Vec<CString>` for C.
 #[derive(Default)]
@@ -47,6 +48,18 @@ pub extern "C" fn VecCString_get(vec: *mut VecCString, index: usize) -> *mut c_c
     vec.inner[index].clone().into_raw()
 }
 
+/// Borrows the string value at the vector index without copying it.
+/// The view is valid until the vector is modified or destroyed.
+#[no_mangle]
+pub extern "C" fn VecCString_getView(vec: *mut VecCString, index: usize) -> RStrView {
+    let vec = unsafe_ref(vec);
+    let bytes = vec.inner[index].as_bytes();
+    RStrView {
+        data: bytes.as_ptr() as *const c_char,
+        len: bytes.len(),
+    }
+}
+
 /// Adds a string value to the end of the vector.
 #[no_mangle]
 pub extern "C" fn VecCString_push(vec: *mut VecCString, value: *const c_char) {
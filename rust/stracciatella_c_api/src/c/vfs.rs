@@ -9,6 +9,7 @@ use stracciatella::vfile::VFile;
 use stracciatella::vfs::{Vfs, VfsLayer};
 
 use crate::c::common::*;
+use crate::c::str_view::RStrView;
 use crate::c::vec::VecCString;
 
 /// Creates a virtual filesystem.
@@ -100,10 +101,10 @@ pub extern "C" fn Vfs_readDir(
 /// Sets the rust error.
 /// coverity[+alloc]
 #[no_mangle]
-pub extern "C" fn VfsFile_open(vfs: *mut Vfs, path: *const c_char) -> *mut VFile {
+pub extern "C" fn VfsFile_open(vfs: *mut Vfs, path: RStrView) -> *mut VFile {
     forget_rust_error();
     let vfs = unsafe_mut(vfs);
-    let path = str_from_c_str_or_panic(unsafe_c_str(path));
+    let path = path.as_str_or_panic();
     match vfs.open(&Nfc::caseless_path(path)) {
         Err(err) => {
             remember_rust_error(format!("VfsFile_open {:?}: {}", path, err));
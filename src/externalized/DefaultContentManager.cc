@@ -73,13 +73,17 @@
 
 #define DIALOGUESIZE 240
 
+// Decoded quote and text files kept around, a speech file is about 100 KB
+#define ENCRYPTED_STRING_FILES_BUDGET (1024 * 1024)
+
 const MercProfileInfo EMPTY_MERC_PROFILE_INFO;
 
 DefaultContentManager::DefaultContentManager(RustPointer<EngineOptions> engineOptions)
 	:m_schemaManager(SchemaManager_create()),
 	mNormalGunChoice(ARMY_GUN_LEVELS),
 	mExtendedGunChoice(ARMY_GUN_LEVELS),
-	m_vfs(Vfs_create())
+	m_vfs(Vfs_create()),
+	m_encryptedStringFiles("Encrypted string files", ENCRYPTED_STRING_FILES_BUDGET)
 {
 	m_engineOptions = std::move(engineOptions);
 	m_modManager.reset(ModManager_create(m_engineOptions.get()));
@@ -298,8 +302,7 @@ std::vector<ST::string> DefaultContentManager::getAllTilecache() const
 	std::vector<ST::string> paths;
 	for (size_t i = 0; i < len; i++)
 	{
-		RustPointer<char> path{VecCString_get(vec.get(), i)};
-		paths.emplace_back(FileMan::joinPaths(TILECACHEDIR, path.get()));
+		paths.emplace_back(FileMan::joinPaths(TILECACHEDIR, fromRStrView(VecCString_getView(vec.get(), i))));
 	}
 	return paths;
 }
@@ -313,7 +316,7 @@ std::vector<ST::string> DefaultContentManager::getAllTilecache() const
  * If file is not found, try to find the file in libraries located in 'Data' directory; */
 SGPFile* DefaultContentManager::openGameResForReading(const ST::string& filename) const
 {
-	RustPointer<VFile> vfile(VfsFile_open(m_vfs.get(), filename.c_str()));
+	RustPointer<VFile> vfile(VfsFile_open(m_vfs.get(), toRStrView(filename)));
 	if (!vfile)
 	{
 		RustPointer<char> err{getRustError()};
@@ -326,7 +329,7 @@ SGPFile* DefaultContentManager::openGameResForReading(const ST::string& filename
 /* Checks if a game resource exists. */
 bool DefaultContentManager::doesGameResExists(const ST::string& filename) const
 {
-	RustPointer<VFile> vfile(VfsFile_open(m_vfs.get(), filename.c_str()));
+	RustPointer<VFile> vfile(VfsFile_open(m_vfs.get(), toRStrView(filename)));
 	return static_cast<bool>(vfile.get());
 }
 
@@ -345,37 +348,63 @@ DirFs *DefaultContentManager::saveGameFiles() const
 	return m_saveGameFiles.get();
 }
 
+/** Read and decode an encrypted string file, or take it from the cache.
+ * The reference is valid until the next file is read. */
+EncryptedStringFile& DefaultContentManager::getEncryptedStringFile(const ST::string& fileName) const
+{
+	std::unique_ptr<EncryptedStringFile>* const cached = m_encryptedStringFiles.find(fileName);
+	if (cached) return **cached;
+
+	AutoSGPFile file(openGameResForReading(fileName));
+	auto f = std::make_unique<EncryptedStringFile>(getStringEncType(), file);
+	size_t const bytes = f->memoryUsage();
+	return *m_encryptedStringFiles.insert(fileName, std::move(f), bytes);
+}
+
+/** Get a string from a cached encrypted string file and account for the converted string. */
+ST::string DefaultContentManager::getCachedEncryptedString(const ST::string& fileName, ST::string& err_msg, uint32_t seek_chars, uint32_t read_chars) const
+{
+	EncryptedStringFile& strings = getEncryptedStringFile(fileName);
+	ST::string str = strings.getString(err_msg, seek_chars, read_chars);
+	m_encryptedStringFiles.resize(fileName, strings.memoryUsage());
+	return str;
+}
+
 /** Load encrypted string from game resource file. */
 ST::string DefaultContentManager::loadEncryptedString(const ST::string& fileName, uint32_t seek_chars, uint32_t read_chars) const
 {
-	AutoSGPFile file(openGameResForReading(fileName));
-	return LoadEncryptedString(file, seek_chars, read_chars);
+	ST::string err_msg;
+	ST::string str = getCachedEncryptedString(fileName, err_msg, seek_chars, read_chars);
+	if (!err_msg.empty())
+	{
+		SLOGW("DefaultContentManager::loadEncryptedString '{}' {} {}: {}", fileName, seek_chars, read_chars, err_msg);
+	}
+	return str;
 }
 
 /** Load dialogue quote from file. */
 ST::string* DefaultContentManager::loadDialogQuoteFromFile(const ST::string& fileName, int quote_number)
 {
-	AutoSGPFile File(openGameResForReading(fileName));
 	ST::string err_msg;
-	ST::string quote = LoadEncryptedData(err_msg, getStringEncType(), File, quote_number * DIALOGUESIZE, DIALOGUESIZE);
+	ST::string quote = getCachedEncryptedString(fileName, err_msg, quote_number * DIALOGUESIZE, DIALOGUESIZE);
 	if (!err_msg.empty())
 	{
 		SLOGW("DefaultContentManager::loadDialogQuoteFromFile '{}' {}: {}", fileName, quote_number, err_msg);
 	}
-	return new ST::string(quote);
+	return new ST::string(std::move(quote));
 }
 
 /** Load all dialogue quotes for a character. */
 void DefaultContentManager::loadAllDialogQuotes(STRING_ENC_TYPE encType, const ST::string& fileName, std::vector<ST::string*> &quotes) const
 {
 	AutoSGPFile File(openGameResForReading(fileName));
-	uint32_t fileSize = File->size();
-	uint32_t numQuotes = fileSize / DIALOGUESIZE / 2;
+	EncryptedStringFile strings(encType, File);
+	uint32_t numQuotes = strings.size() / DIALOGUESIZE;
 
 	for(uint32_t i = 0; i < numQuotes; i++)
 	{
 		ST::string err;
-		ST::string quote = LoadEncryptedData(err, encType, File, i * DIALOGUESIZE, DIALOGUESIZE);
+		ST::string const& quote = strings.getString(err, i * DIALOGUESIZE, DIALOGUESIZE);
 		if (!err.empty())
 		{
 			SLOGW("DefaultContentManager::loadAllDialogQuotes '{}' {}: {}", fileName, i, err);
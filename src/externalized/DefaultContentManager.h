@@ -12,6 +12,7 @@
 #include "StringEncodingTypes.h"
 #include "RustInterface.h"
 #include "ItemStrings.h"
+#include "ResourceCache.h"
 
 #include <string_theory/string>
 
@@ -20,6 +21,8 @@
 #include <stdexcept>
 #include <vector>
 
+class EncryptedStringFile;
+
 class DefaultContentManager : public ContentManager, public IGameDataLoader
 {
 public:
@@ -248,6 +251,12 @@ protected:
 
 	RustPointer<Vfs> m_vfs;
 
+	/** Recently read encrypted string files, by file name. */
+	mutable ResourceCache<ST::string, std::unique_ptr<EncryptedStringFile>> m_encryptedStringFiles;
+
+	EncryptedStringFile& getEncryptedStringFile(const ST::string& fileName) const;
+	ST::string getCachedEncryptedString(const ST::string& fileName, ST::string& err_msg, uint32_t seek_chars, uint32_t read_chars) const;
+
 	bool loadWeapons(const VanillaItemStrings& vanillaItemStrings);
 	bool loadItems(const VanillaItemStrings& vanillaItemStrings);
 	bool loadMagazines(const VanillaItemStrings& vanillaItemStrings);
@@ -2,4 +2,18 @@
 
 #include "stracciatella.h"
 
+#include <string_theory/string>
+
 void throwRustError(bool condition);
+
+// Borrow the characters of a string for the duration of a call into Rust.
+inline RStrView toRStrView(const ST::string& str)
+{
+	return RStrView{ str.c_str(), str.size() };
+}
+
+// Copy a string that Rust lends out, a null view becomes an empty string.
+inline ST::string fromRStrView(RStrView view)
+{
+	return view.data ? ST::string(view.data, view.len) : ST::string();
+}
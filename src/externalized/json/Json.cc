@@ -41,9 +41,9 @@ bool JsonValue::isString() const {
 }
 
 ST::string JsonValue::toString() const {
-	RustPointer<char> str(RJsonValue_toString(m_value.get()));
-	throwRustError(!str);
-	return str.get();
+	RStrView str{RJsonValue_toStrView(m_value.get())};
+	throwRustError(!str.data);
+	return fromRStrView(str);
 }
 
 bool JsonValue::isInt() const {
@@ -126,7 +126,10 @@ ST::string JsonValue::serialize(bool pretty) const {
 
 ST::string JsonObject::GetString(const char *name) const
 {
-    return GetValue(name).toString();
+    // borrow the string in place instead of copying the value out of the object first
+    RStrView str{RJsonObject_getStrView(m_value.get(), name)};
+    throwRustError(!str.data);
+    return fromRStrView(str);
 }
 
 int JsonObject::GetInt(const char *name) const
@@ -233,9 +236,7 @@ std::vector<ST::string> JsonObject::keys() const
 	auto size = VecCString_len(rKeys.get());
 	std::vector<ST::string> keys;
 	for (uintptr_t i = 0; i < size; i++) {
-		RustPointer<char> key(VecCString_get(rKeys.get(), i));
-		throwRustError(!key);
-		keys.emplace_back(key.get());
+		keys.emplace_back(fromRStrView(VecCString_getView(rKeys.get(), i)));
 	}
     return keys;
 }
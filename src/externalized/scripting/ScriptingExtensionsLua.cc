@@ -358,7 +358,7 @@ static void LogLuaMessage(LogLevel level, std::string msg) {
 	// Stack position 1 is the calling lua script
 	lua_getstack(lua, 1, &info);
 	lua_getinfo(lua, "S", &info);
-	Logger_log(level, msg.c_str(), info.short_src);
+	Logger_log(level, RStrView{ msg.c_str(), msg.size() }, info.short_src);
 }
 
 static void RegisterLogger()
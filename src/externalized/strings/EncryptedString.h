@@ -5,5 +5,32 @@
 
 #include <string_theory/string>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 ST::string LoadEncryptedString(SGPFile* File, uint32_t seek_chars, uint32_t read_chars);
 ST::string LoadEncryptedData(ST::string& err_msg, STRING_ENC_TYPE encType, SGPFile* File, UINT32 seek_chars, UINT32 read_chars);
+
+
+/**
+ * All records of an encrypted string file, read and decoded in one go.
+ * The strings are converted on first use and kept for later lookups. */
+class EncryptedStringFile
+{
+public:
+	EncryptedStringFile(STRING_ENC_TYPE encType, SGPFile* File);
+
+	/** Same as LoadEncryptedData() on the file, but without any file access. */
+	const ST::string& getString(ST::string& err_msg, UINT32 seek_chars, UINT32 read_chars);
+
+	/** Size of the file in characters. */
+	UINT32 size() const { return static_cast<UINT32>(m_data.size()); }
+
+	/** Approximate number of bytes held by the decoded file and the converted strings. */
+	size_t memoryUsage() const;
+
+private:
+	std::vector<char16_t> m_data;
+	std::map<std::pair<UINT32, UINT32>, ST::string> m_strings;
+};
@@ -43,14 +43,23 @@ ST::string VanillaItemStrings::filename() {
 VanillaItemStrings VanillaItemStrings::deserialize(SGPFile* file) {
 	auto itemStrings = VanillaItemStrings();
 	uint16_t index = 0;
+	EncryptedStringFile strings(getStringEncType(), file);
+	auto load = [&strings](uint32_t seek, uint32_t size) {
+		ST::string err_msg;
+		ST::string str = strings.getString(err_msg, seek, size);
+		if (!err_msg.empty()) {
+			SLOGW("VanillaItemStrings {} {}: {}", seek, size, err_msg);
+		}
+		return str;
+	};
 
 	while (true) {
 		try {
 			uint32_t seek = (SIZE_SHORT_ITEM_NAME + SIZE_ITEM_NAME + SIZE_ITEM_INFO) * index;
 
-			auto shortName = LoadEncryptedString(file, seek, SIZE_SHORT_ITEM_NAME);
-			auto name = LoadEncryptedString(file, seek + SIZE_SHORT_ITEM_NAME, SIZE_ITEM_NAME);
-			auto description = LoadEncryptedString(file, seek + SIZE_SHORT_ITEM_NAME + SIZE_ITEM_NAME, SIZE_ITEM_INFO);
+			auto shortName = load(seek, SIZE_SHORT_ITEM_NAME);
+			auto name = load(seek + SIZE_SHORT_ITEM_NAME, SIZE_ITEM_NAME);
+			auto description = load(seek + SIZE_SHORT_ITEM_NAME + SIZE_ITEM_NAME, SIZE_ITEM_INFO);
 
 			itemStrings.items.emplace(std::make_pair(index, VanillaItem{shortName, name, description}));
 
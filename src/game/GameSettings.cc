@@ -3,6 +3,7 @@
 #include "Types.h"
 #include "GameSettings.h"
 #include "FileMan.h"
+#include "BattleSimulator.h"
 #include "Sound_Control.h"
 #include "SaveLoadScreen.h"
 #include "Music_Control.h"
@@ -267,7 +268,8 @@ BOOLEAN	CanGameBeSaved()
 
 void DoDeadIsDeadSaveIfNecessary()
 {
-	if (gGameOptions.ubGameSaveMode == DIF_DEAD_IS_DEAD)
+	// A simulated battle must not overwrite the save it was loaded from
+	if (gGameOptions.ubGameSaveMode == DIF_DEAD_IS_DEAD && !gfBattleSimulation)
 	{
 		DoDeadIsDeadSave();
 	}
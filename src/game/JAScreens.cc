@@ -41,12 +41,13 @@
 #include "Timer.h"
 #include "Logger.h"
 #include "WordWrap.h"
+#include "ResourceCache.h"
 
 #include <string_theory/format>
 #include <string_theory/string>
 
 
-#define MAX_DEBUG_PAGES 4
+#define MAX_DEBUG_PAGES 5
 
 
 // GLOBAL FOR PAL EDITOR
@@ -65,6 +66,7 @@ static void DefaultDebugPage1(void);
 static void DefaultDebugPage2(void);
 static void DefaultDebugPage3(void);
 static void DefaultDebugPage4(void);
+static void DefaultDebugPage5(void);
 
 
 RENDER_HOOK				gDebugRenderOverride[ MAX_DEBUG_PAGES ] =
@@ -72,7 +74,8 @@ RENDER_HOOK				gDebugRenderOverride[ MAX_DEBUG_PAGES ] =
 	DefaultDebugPage1,
 	DefaultDebugPage2,
 	DefaultDebugPage3,
-	DefaultDebugPage4
+	DefaultDebugPage4,
+	DefaultDebugPage5
 };
 
 
@@ -417,6 +420,27 @@ static void DefaultDebugPage4(void)
 }
 
 
+// Memory used by the resource caches
+static void DefaultDebugPage5(void)
+{
+	INT32 const h = DEBUG_PAGE_LINE_HEIGHT;
+
+	MPageHeader("RESOURCE CACHES");
+
+	INT32 y = DEBUG_PAGE_START_Y;
+	for (ResourceCacheBase const* const cache : ResourceCacheBase::all())
+	{
+		ResourceCacheStats const s = cache->stats();
+		MHeader(DEBUG_PAGE_FIRST_COLUMN, y += h, s.name);
+		MPrintStat(DEBUG_PAGE_FIRST_COLUMN,  y += h, "Entries:",  ST::format("{} ({} pinned)", s.entries, s.pinned));
+		MPrintStat(DEBUG_PAGE_SECOND_COLUMN, y,      "KB:",       ST::format("{} / {}", s.bytes / 1024, s.budget / 1024));
+		MPrintStat(DEBUG_PAGE_FIRST_COLUMN,  y += h, "Hits:",     ST::format("{} / {}", s.hits, s.hits + s.misses));
+		MPrintStat(DEBUG_PAGE_SECOND_COLUMN, y,      "Evictions:", ST::format("{}", s.evictions));
+		y += h;
+	}
+}
+
+
 #define SMILY_DELAY						100
 #define SMILY_END_DELAY				1000
 
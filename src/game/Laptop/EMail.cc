@@ -30,6 +30,11 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
 
 #define MAX_MESSAGES_PAGE 18 // max number of messages per page
 
@@ -47,13 +52,6 @@ enum EMailSortCriteria
 };
 
 
-struct Page
-{
-	Email* Mail[MAX_MESSAGES_PAGE];
-	Page* Next;
-};
-
-
 struct Record
 {
 	ST::string pRecord;
@@ -70,7 +68,9 @@ struct EmailPageInfoStruct
 
 
 Email* pEmailList;
-static Page* pPageList;
+// All mails in list order, pEmailList is linked in the same order. The pages
+// of the mail list are consecutive runs of MAX_MESSAGES_PAGE mails.
+static std::vector<Email*> gEmails;
 static INT32 iLastPage=-1;
 static INT32 iCurrentPage=0;
 Email* MailToDelete;
@@ -277,7 +277,7 @@ static void DeleteEmailMouseRegions()
 void GameInitEmail()
 {
 	pEmailList=NULL;
-	pPageList=NULL;
+	gEmails.clear();
 
 	iLastPage=-1;
 
@@ -519,7 +519,7 @@ static ST::string LoadEMailText(UINT32 entry)
 }
 
 
-static void AddMessageToPages(Email* Mail);
+static void UpdateEmailPageCount();
 static ST::string ReplaceMercNameAndAmountWithProperData(const ST::string& pFinishedString, const Email* pMail);
 
 
@@ -546,12 +546,10 @@ void AddEmailMessage(INT32 iMessageOffset, INT32 iMessageLength, INT32 iDate, UI
 	pSubject = ReplaceMercNameAndAmountWithProperData(pSubject, pTempEmail);
 	pTempEmail->pSubject = ST::format(" {}", pSubject);
 
-	// place into list
-	Email* pEmail = pEmailList;
+	// place at end of list
+	Email* const pEmail = gEmails.empty() ? NULL : gEmails.back();
 	if(pEmail)
 	{
-		// list exists, place at end
-		while (pEmail->Next != NULL) pEmail = pEmail->Next;
 		pEmail->Next = pTempEmail;
 	}
 	else
@@ -568,7 +566,8 @@ void AddEmailMessage(INT32 iMessageOffset, INT32 iMessageLength, INT32 iDate, UI
 	fNewMailFlag=TRUE;
 
 	// add this message to the pages of email
-	AddMessageToPages(pTempEmail);
+	gEmails.push_back(pTempEmail);
+	UpdateEmailPageCount();
 
 	// reset read flag of this particular message
 	pTempEmail->fRead=fAlreadyRead;
@@ -589,143 +588,91 @@ static void RemoveEmailMessage(Email* Mail)
 		Assert(pEmailList == Mail);
 		pEmailList = Next;
 	}
+	gEmails.erase(std::find(gEmails.begin(), gEmails.end(), Mail));
 	delete Mail;
 }
 
 
-static void AddEmailPage(void)
+static void UpdateEmailPageCount()
 {
-	Page* const p = new Page{};
-	FOR_EACH(Email*, i, p->Mail) *i = 0;
-	p->Next = NULL;
-
-	if (pPageList)
-	{
-		Page* last = pPageList;
-		while (last->Next) last = last->Next;
-		last->Next = p;
-	}
-	else
-	{
-		pPageList = p;
-	}
-
-	iLastPage++;
+	iLastPage = static_cast<INT32>((gEmails.size() + MAX_MESSAGES_PAGE - 1) / MAX_MESSAGES_PAGE) - 1;
 }
 
 
-static void AddMessageToPages(Email* Mail)
+// Relink pEmailList so it follows the order of gEmails
+static void RelinkEmailList()
 {
-	// go to end of page list
-	Page* pPage = pPageList;
-	INT32 iCounter=0;
-	if(!pPage)
-		AddEmailPage();
-	pPage=pPageList;
-	while (pPage->Next != NULL && pPage->Mail[MAX_MESSAGES_PAGE - 1] != NULL)
-		pPage=pPage->Next;
-	// if list is full, add new page
-	while(iCounter <MAX_MESSAGES_PAGE)
-	{
-		if (pPage->Mail[iCounter] == NULL) break;
-		iCounter++;
-	}
-	if(iCounter==MAX_MESSAGES_PAGE)
-	{
-		AddEmailPage();
-		AddMessageToPages(Mail);
-	}
-	else
+	Email* Prev = NULL;
+	for (Email* const Mail : gEmails)
 	{
-		pPage->Mail[iCounter] = Mail;
+		Mail->Prev = Prev;
+		Mail->Next = NULL;
+		if (Prev != NULL) Prev->Next = Mail;
+		Prev = Mail;
 	}
+	pEmailList = gEmails.empty() ? NULL : gEmails.front();
 }
 
 
 static void SortMessages(EMailSortCriteria Criterium)
 {
-	Email* NewList = NULL;
-
-	for (Email* List = pEmailList; List != NULL;)
+	// Sorting is stable, mails which compare equal keep their previous order
+	switch (Criterium)
 	{
-		Email* Mail = List;
-		List = List->Next;
+		case RECEIVED:
+			std::stable_sort(gEmails.begin(), gEmails.end(), [](const Email* a, const Email* b)
+			{
+				return fSortDateUpwards ? a->iDate < b->iDate : a->iDate > b->iDate;
+			});
+			break;
 
-		Email* InsAfter = NULL;
-		for (Email* Other = NewList; Other != NULL; Other = Other->Next)
+		case SENDER:
 		{
-			INT Order; // XXX HACK000E
-			switch (Criterium)
+			// rank the sender names once, so mails are ordered by a number
+			// instead of comparing the names for every pair of mails
+			std::array<UINT8, pSenderNameList_SIZE> Senders;
+			std::iota(Senders.begin(), Senders.end(), 0);
+			std::sort(Senders.begin(), Senders.end(), [](UINT8 a, UINT8 b)
 			{
-				case RECEIVED:
-					Order = Mail->iDate - Other->iDate;
-					if (fSortDateUpwards) Order = -Order;
-					break;
-
-				case SENDER:
-					Order = pSenderNameList[Mail->ubSender].compare(pSenderNameList[Other->ubSender]);
-					if (fSortSenderUpwards) Order = -Order;
-					break;
-
-				case SUBJECT:
-					Order = Mail->pSubject.compare(Other->pSubject);
-					if (fSortSubjectUpwards) Order = -Order;
-					break;
-
-				case READ:
-					Order = Other->fRead - Mail->fRead;
-					break;
-
-				default: abort(); // HACK000E
+				return pSenderNameList[a].compare(pSenderNameList[b]) < 0;
+			});
+			std::array<UINT8, pSenderNameList_SIZE> Rank;
+			for (UINT8 i = 0; i < Senders.size(); ++i)
+			{
+				// equal names share the rank of the first one
+				bool const same = i > 0 && pSenderNameList[Senders[i]] == pSenderNameList[Senders[i - 1]];
+				Rank[Senders[i]] = same ? Rank[Senders[i - 1]] : i;
 			}
-			if (Order > 0) break;
-			InsAfter = Other;
-		}
-		Mail->Prev = InsAfter;
-		if (InsAfter == NULL)
-		{
-			Mail->Next = NewList;
-			NewList = Mail;
-		}
-		else
-		{
-			Mail->Next = InsAfter->Next;
-			InsAfter->Next = Mail;
+			std::stable_sort(gEmails.begin(), gEmails.end(), [&Rank](const Email* a, const Email* b)
+			{
+				UINT8 const ra = Rank[a->ubSender];
+				UINT8 const rb = Rank[b->ubSender];
+				return fSortSenderUpwards ? ra < rb : ra > rb;
+			});
+			break;
 		}
-		if (Mail->Next != NULL) Mail->Next->Prev = Mail;
-	}
-	pEmailList = NewList;
-
-	fReDrawScreenFlag = TRUE;
-}
 
+		case SUBJECT:
+			std::stable_sort(gEmails.begin(), gEmails.end(), [](const Email* a, const Email* b)
+			{
+				INT const Order = a->pSubject.compare(b->pSubject);
+				return fSortSubjectUpwards ? Order < 0 : Order > 0;
+			});
+			break;
 
-static void ClearPages(void)
-{
-	// run through list of message pages and set to -1
-	for (Page* i = pPageList; i;)
-	{
-		Page* const next = i->Next;
-		delete i;
-		i = next;
+		case READ:
+			std::stable_partition(gEmails.begin(), gEmails.end(), [](const Email* m) { return !m->fRead; });
+			break;
 	}
+	RelinkEmailList();
 
-	pPageList = NULL;
-	iLastPage = -1;
+	fReDrawScreenFlag = TRUE;
 }
 
 
 static void PlaceMessagesinPages(void)
 {
-	Email* pEmail = pEmailList;
-	// run through the list of messages and add to pages
-	ClearPages();
-	while(pEmail)
-	{
-		AddMessageToPages(pEmail);
-		pEmail=pEmail->Next;
-
-	}
+	UpdateEmailPageCount();
 	if(iCurrentPage >iLastPage)
 		iCurrentPage=iLastPage;
 }
@@ -752,14 +699,14 @@ static void DrawEmailSummary(INT32 y, const Email* e)
 }
 
 
-static Page* GetCurrentPage(void)
+// The mail in the given row of the current page, NULL if the row is empty
+static Email* GetMailOnCurrentPage(INT32 const Row)
 {
-	Page* i = pPageList;
-	if (i == NULL) return i;
+	if (iLastPage < 0) return NULL;
 
-	INT32 PageID = 0;
-	while (i->Next != NULL && PageID++ != iCurrentPage) i = i->Next;
-	return i;
+	INT32 const Page = std::clamp(iCurrentPage, 0, iLastPage);
+	size_t const Index = Page * MAX_MESSAGES_PAGE + Row;
+	return Index < gEmails.size() ? gEmails[Index] : NULL;
 }
 
 
@@ -770,8 +717,7 @@ static void DisplayEmailList(void)
 	// if current page ever ends up negative, reset to 0
 	if (iCurrentPage == -1) iCurrentPage = 0;
 
-	const Page* const p = GetCurrentPage();
-	if (p == NULL) return;
+	if (iLastPage < 0) return;
 
 	// now we have current page, display it
 	SetFontForeground(FONT_BLACK);
@@ -780,10 +726,11 @@ static void DisplayEmailList(void)
 
 	// draw each line of the list for this page
 	INT32 y = MIDDLE_Y;
-	FOR_EACH(Email* const, e, p->Mail)
+	for (INT32 i = 0; i < MAX_MESSAGES_PAGE; ++i)
 	{
-		if (!*e) break;
-		DrawEmailSummary(y, *e);
+		const Email* const e = GetMailOnCurrentPage(i);
+		if (!e) break;
+		DrawEmailSummary(y, e);
 		y += MIDDLE_WIDTH;
 	}
 
@@ -844,13 +791,10 @@ static void EmailBtnCallBackPrimary(MOUSE_REGION* pRegion, UINT32 iReason)
 	if(fDisplayMessageFlag)
 		return;
 
-	Page* pPage = GetCurrentPage();
-	if (pPage == NULL) return;
-
 	// error check
 	INT32 iCount = MSYS_GetRegionUserData(pRegion, 0);
 
-	Email* Mail = pPage->Mail[iCount];
+	Email* Mail = GetMailOnCurrentPage(iCount);
 
 	// invalid message
 	if (Mail == NULL)
@@ -870,8 +814,7 @@ static void EmailBtnCallBackSecondary(MOUSE_REGION* pRegion, UINT32 iReason)
 	if(fDisplayMessageFlag)
 		return;
 
-	Page* pPage = GetCurrentPage();
-	if (pPage == NULL)
+	if (iLastPage < 0)
 	{
 		HandleRightButtonUpEvent();
 		return;
@@ -881,7 +824,7 @@ static void EmailBtnCallBackSecondary(MOUSE_REGION* pRegion, UINT32 iReason)
 
 	giMessagePage = 0;
 
-	Email* Mail = pPage->Mail[iCount];
+	Email* Mail = GetMailOnCurrentPage(iCount);
 	if (Mail == NULL)
 	{
 		// no mail here, handle right button up event
@@ -2302,15 +2245,10 @@ static INT32 GetNumberOfPagesToEmail(void)
 void ShutDownEmailList()
 {
 	// Loop through all the emails to delete them
-	Email* i = pEmailList;
+	for (Email* const i : gEmails) delete i;
+	gEmails.clear();
 	pEmailList = 0;
-	while (i)
-	{
-		Email* const del = i;
-		i = i->Next;
-		delete del;
-	}
-	ClearPages();
+	iLastPage = -1;
 }
 
 
@@ -120,7 +120,9 @@
 
 #include <regex>
 #include <algorithm>
+#include <map>
 #include <stdexcept>
+#include <vector>
 
 static const ST::string g_backup_dir     = "Backup";
 static const ST::string g_quicksave_name = "QuickSave";
@@ -130,6 +132,21 @@ static const ST::string g_error_save_name = "Error";
 static const ST::string g_savegame_name  = "SaveGame";
 static const ST::string g_savegame_ext   = "sav";
 
+/* Content of the temp files as last written to or read from a saved game.
+ * All temp files are changed through GCM->tempFiles(), so while the change
+ * stamp of a file is the same, the next save can write the kept content
+ * instead of reading the file again. Most sector temp files do not change
+ * between two saves. */
+struct SavedTempFile
+{
+	uint64_t           stamp;
+	UINT32             save; // the last save that wrote the file
+	std::vector<UINT8> data;
+};
+
+static std::map<ST::string, SavedTempFile> g_saved_temp_files;
+static UINT32 g_save_count = 0;
+
 //Global variable used
 
 extern		INT32					giSortStateForMapScreenList;
@@ -279,6 +296,7 @@ BOOLEAN SaveGame(const ST::string& saveName, const ST::string& gameDesc)
 
 	// Set the fact that we are saving a game
 	gTacticalStatus.uiFlags |= LOADING_SAVED_GAME;
+	++g_save_count;
 
 	ST::string savegamePath = GetSaveGamePath(saveName);
 	ST::string savegameTempPath = FileMan::joinPaths("save", savegamePath);
@@ -472,6 +490,12 @@ BOOLEAN SaveGame(const ST::string& saveName, const ST::string& gameDesc)
 		FileMan::moveFile(GCM->tempFiles()->absolutePath(savegameTempPath), GCM->saveGameFiles()->absolutePath(savegamePath));
 
 		GCM->tempFiles()->deleteFile(savegameTempPath);
+
+		// Forget the temp files that are gone
+		for (auto i = g_saved_temp_files.begin(); i != g_saved_temp_files.end();)
+		{
+			i = i->second.save != g_save_count ? g_saved_temp_files.erase(i) : std::next(i);
+		}
 	}
 	catch (std::runtime_error const& e)
 	{
@@ -1485,51 +1509,49 @@ void BackupSavedGame(const ST::string &saveName)
 	}
 }
 
-static void SaveFileToSavedGame(SGPFile* fileToSave, HWFILE const hFile)
+void SaveFilesToSavedGame(ST::string const& pSrcFileName, HWFILE const hFile)
 {
-	//Get the file size of the source data file
-	UINT32 uiFileSize = fileToSave->size();
+	DirFs* const   temp_files = GCM->tempFiles();
+	uint64_t const stamp      = temp_files->getChangeStamp(pSrcFileName);
+
+	auto i = g_saved_temp_files.find(pSrcFileName);
+	if (i == g_saved_temp_files.end() || i->second.stamp != stamp)
+	{
+		AutoSGPFile hSrcFile(temp_files->openForReading(pSrcFileName));
+		i = g_saved_temp_files.insert_or_assign(pSrcFileName, SavedTempFile{ stamp, 0, hSrcFile->readToEnd() }).first;
+	}
+	SavedTempFile& file = i->second;
+	file.save = g_save_count;
 
-	// Write the the size of the file to the saved game file
+	// Write the size of the file to the saved game file
+	UINT32 const uiFileSize = static_cast<UINT32>(file.data.size());
 	hFile->write(&uiFileSize, sizeof(UINT32));
 
 	if (uiFileSize == 0) return;
 
-	// Read the source file into the buffer
-	SGP::Buffer<UINT8> pData(uiFileSize);
-	fileToSave->read(pData, uiFileSize);
-
-	// Write the buffer to the saved game file
-	hFile->write(pData, uiFileSize);
+	hFile->write(file.data.data(), uiFileSize);
 }
 
-void SaveFilesToSavedGame(ST::string const& pSrcFileName, HWFILE const hFile)
-{
-	AutoSGPFile hSrcFile(GCM->tempFiles()->openForReading(pSrcFileName));
-	SaveFileToSavedGame(hSrcFile, hFile);
-}
 
-
-static void LoadFileFromSavedGame(SGPFile* fileToWrite, HWFILE const hFile)
+void LoadFilesFromSavedGame(ST::string const& pSrcFileName, HWFILE const hFile)
 {
 	// Read the size of the data
 	UINT32 uiFileSize;
 	hFile->read(&uiFileSize, sizeof(UINT32));
 
-	if (uiFileSize == 0) return;
-
-	// Read into the buffer
-	SGP::Buffer<UINT8> pData(uiFileSize);
-	hFile->read(pData, uiFileSize);
+	std::vector<UINT8> data(uiFileSize);
+	if (uiFileSize != 0) hFile->read(data.data(), uiFileSize);
 
-	// Write the buffer to the new file
-	fileToWrite->write(pData, uiFileSize);
-}
+	DirFs* const temp_files = GCM->tempFiles();
+	{
+		// Write the buffer to the new file
+		AutoSGPFile hSrcFile(temp_files->openForWriting(pSrcFileName, true));
+		if (uiFileSize != 0) hSrcFile->write(data.data(), uiFileSize);
+	}
 
-void LoadFilesFromSavedGame(ST::string const& pSrcFileName, HWFILE const hFile)
-{
-	AutoSGPFile hSrcFile(GCM->tempFiles()->openForWriting(pSrcFileName, true));
-	LoadFileFromSavedGame(hSrcFile, hFile);
+	// The next save writes the file as it was loaded, unless it changes
+	uint64_t const stamp = temp_files->getChangeStamp(pSrcFileName);
+	g_saved_temp_files.insert_or_assign(pSrcFileName, SavedTempFile{ stamp, g_save_count, std::move(data) });
 }
 
 static void SaveTacticalStatusToSavedGame(HWFILE const f)
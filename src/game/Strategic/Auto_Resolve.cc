@@ -36,6 +36,7 @@
 #include "Strategic.h"
 #include "Strategic_AI.h"
 #include "Strategic_Merc_Handler.h"
+#include "Strategic_Mines.h"
 #include "Strategic_Status.h"
 #include "Strategic_Town_Loyalty.h"
 #include "SysUtil.h"
@@ -326,6 +327,7 @@ void EliminateAllEnemies(const SGPSector& ubSector)
 		pSector->ubNumElites = 0;
 		pSector->ubNumAdmins = 0;
 		pSector->ubNumCreatures = 0;
+		InvalidateMineTownControl();
 		//Remove the mobile forces here, but only if battle is over.
 		FOR_EACH_GROUP_SAFE(i)
 		{
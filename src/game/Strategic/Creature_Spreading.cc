@@ -96,13 +96,11 @@
 BOOLEAN gfUseCreatureMusic = FALSE;
 BOOLEAN gfCreatureMeanwhileScenePlayed = FALSE;
 
-struct CREATURE_DIRECTIVE
-{
-	CREATURE_DIRECTIVE*     next;
-	UNDERGROUND_SECTORINFO *pLevel;
-};
-
-CREATURE_DIRECTIVE *gLair;
+//The sectors of the active lair in the order the creatures spread through them, starting
+//with the queen.  They are resolved once when the lair is set up.
+static std::vector<UNDERGROUND_SECTORINFO*> gLair;
+//Position in gLair plus one for each sector, zero if the sector isn't part of the lair.
+static UINT8 gubLairNodeOfSector[4][256];
 const CreatureLairModel* gLairModel;
 
 INT32 giHabitatedDistance = 0;
@@ -123,48 +121,51 @@ UINT8 gubCreatureBattleCode = CREATURE_BATTLE_CODE_NONE;
 UINT8 gubSectorIDOfCreatureAttack = 0;
 
 
-static CREATURE_DIRECTIVE* NewDirective(UINT8 ubSectorID, UINT8 ubSectorZ, UINT8 ubCreatureHabitat)
+static void ClearCreatureLair()
 {
-	CREATURE_DIRECTIVE* const curr = new CREATURE_DIRECTIVE{};
-	SGPSector ubSector = SGPSector::FromSectorID(ubSectorID, ubSectorZ);
-	curr->pLevel = FindUnderGroundSector(ubSector);
-	if( !curr->pLevel )
-	{
-		SLOGA("Could not find underground sector node ({}) that should exist.", ubSector);
-		delete curr;
-		return 0;
-	}
+	gLair.clear();
+	std::fill_n(&gubLairNodeOfSector[0][0], sizeof(gubLairNodeOfSector), 0);
+}
 
-	curr->pLevel->ubCreatureHabitat = ubCreatureHabitat;
-	curr->next = NULL;
-	return curr;
+static UNDERGROUND_SECTORINFO* FindLairSector(const SGPSector& sector)
+{
+	if (!sector.IsValid() || sector.z == 0) return NULL;
+	UINT8 const ubNode = gubLairNodeOfSector[sector.z][sector.AsByte()];
+	return ubNode ? gLair[ubNode - 1] : NULL;
+}
+
+//Creature counts are queried often, so sectors of the lair are found without walking the
+//list of all underground sectors.
+static UNDERGROUND_SECTORINFO* FindCreatureSector(const SGPSector& sector)
+{
+	UNDERGROUND_SECTORINFO* const pLairSector = FindLairSector(sector);
+	return pLairSector ? pLairSector : FindUnderGroundSector(sector);
 }
 
 static void InitCreatureLair(const CreatureLairModel* lairModel)
 {
 	gLairModel = lairModel;
-
-	CREATURE_DIRECTIVE* curr = NULL;
 	giLairID = lairModel->lairId;
 
-	//initialize the linked list of lairs
+	ClearCreatureLair();
 	for (auto const& sec : lairModel->lairSectors)
 	{
-		auto next = NewDirective(sec.sectorId, sec.sectorLevel, sec.habitatType);
-		if (sec.habitatType == QUEEN_LAIR && !next->pLevel->ubNumCreatures)
+		SGPSector const sector = SGPSector::FromSectorID(sec.sectorId, sec.sectorLevel);
+		UNDERGROUND_SECTORINFO* const pLevel = FindUnderGroundSector(sector);
+		if (!pLevel)
 		{
-			next->pLevel->ubNumCreatures = 1;	//for the queen.
+			SLOGA("Could not find underground sector node ({}) that should exist.", sector);
+			continue;
 		}
 
-		if (curr == NULL)
-		{ // first node, set gLair to the start of list
-			gLair = next;
-		}
-		else
-		{ // append to list
-			curr->next = next;
+		pLevel->ubCreatureHabitat = sec.habitatType;
+		if (sec.habitatType == QUEEN_LAIR && !pLevel->ubNumCreatures)
+		{
+			pLevel->ubNumCreatures = 1;	//for the queen.
 		}
-		curr = next;
+
+		gLair.push_back(pLevel);
+		gubLairNodeOfSector[sector.z][sector.AsByte()] = (UINT8)gLair.size();
 	}
 }
 
@@ -240,7 +241,7 @@ void InitCreatureQuest()
 
 	// enable the lair entrance
 	UINT8 entranceSector = lairModel->entranceSector;
-	UNDERGROUND_SECTORINFO* lairEntrance = FindUnderGroundSector(SGPSector::FromSectorID(entranceSector, lairModel->entranceSectorLevel));
+	UNDERGROUND_SECTORINFO* lairEntrance = FindCreatureSector(SGPSector::FromSectorID(entranceSector, lairModel->entranceSectorLevel));
 	if (lairEntrance == NULL)
 	{
 		throw std::runtime_error("Lair entrance sector is not defined as an underground sector");
@@ -252,17 +253,15 @@ void InitCreatureQuest()
 	{
 		case DIF_LEVEL_EASY:
 			i = EASY_QUEEN_INIT_BONUS_SPREADS;
-			AddPeriodStrategicEvent( EVENT_CREATURE_SPREAD, EASY_SPREAD_TIME_IN_MINUTES, 0 );
 			break;
 		case DIF_LEVEL_MEDIUM:
 			i = NORMAL_QUEEN_INIT_BONUS_SPREADS;
-			AddPeriodStrategicEvent( EVENT_CREATURE_SPREAD, NORMAL_SPREAD_TIME_IN_MINUTES, 0 );
 			break;
 		case DIF_LEVEL_HARD:
 			i = HARD_QUEEN_INIT_BONUS_SPREADS;
-			AddPeriodStrategicEvent( EVENT_CREATURE_SPREAD, HARD_SPREAD_TIME_IN_MINUTES, 0 );
 			break;
 	}
+	AddPeriodStrategicEvent( EVENT_CREATURE_SPREAD, GetCreatureSpreadTime( gGameOptions.ubDifficultyLevel ), 0 );
 
 	//Set things up so that the creatures can plan attacks on helpless miners and civilians while
 	//they are sleeping.  They do their planning at 10PM every day, and decide to attack sometime
@@ -277,136 +276,146 @@ void InitCreatureQuest()
 }
 
 
-static void AddCreatureToNode(CREATURE_DIRECTIVE* node)
+UINT32 GetCreatureSpreadTime(UINT8 const ubDifficultyLevel)
+{
+	switch( ubDifficultyLevel )
+	{
+		case DIF_LEVEL_EASY:   return EASY_SPREAD_TIME_IN_MINUTES;
+		case DIF_LEVEL_MEDIUM: return NORMAL_SPREAD_TIME_IN_MINUTES;
+		default:               return HARD_SPREAD_TIME_IN_MINUTES;
+	}
+}
+
+
+static void SetLairSectorPopulation(UNDERGROUND_SECTORINFO* pLevel, UINT8 ubNumCreatures)
 {
-	node->pLevel->ubNumCreatures++;
+	pLevel->ubNumCreatures = ubNumCreatures;
 
-	if( node->pLevel->uiFlags & SF_PENDING_ALTERNATE_MAP )
+	if( pLevel->uiFlags & SF_PENDING_ALTERNATE_MAP )
 	{ //there is an alternate map meaning that there is a dynamic opening.  From now on
 		//we substitute this map.
-		node->pLevel->uiFlags &= ~SF_PENDING_ALTERNATE_MAP;
-		node->pLevel->uiFlags |= SF_USE_ALTERNATE_MAP;
+		pLevel->uiFlags &= ~SF_PENDING_ALTERNATE_MAP;
+		pLevel->uiFlags |= SF_USE_ALTERNATE_MAP;
 	}
 }
 
 
-static BOOLEAN PlaceNewCreature(CREATURE_DIRECTIVE* node, INT32 iDistance)
+INT32 PlaceCreatureInLair(std::vector<CREATURE_LAIR_NODE>& lair, INT32& iHabitatedDistance, UINT8 const ubDifficultyLevel)
 {
-	if( !node )
-		return FALSE;
 	//check to see if the creatures are permitted to spread into certain areas.  There are 4 mines (human perspective), and
 	//creatures won't spread to them until the player controls them.  Additionally, if the player has recently cleared the
 	//mine, then temporarily prevent the spreading of creatures.
-
-	if( giHabitatedDistance == iDistance )
-	{	//FRONT-LINE CONDITIONS -- consider expansion or frontline fortification.  The formulae used
-		//in this sector are geared towards outer expansion.
-		//we have reached the distance limitation for the spreading.  We will determine if
-		//the area is populated enough to spread further.  The minimum population must be 4 before
-		//spreading is even considered.
-		if( node->pLevel->ubNumCreatures*10 - 10 <= (INT32)Random( 60 ) )
-		{
-			// x<=1 100%
-			// x==2  83%
-			// x==3  67%
-			// x==4  50%
-			// x==5  33%
-			// x==6  17%
-			// x>=7   0%
-			AddCreatureToNode( node );
-			return TRUE;
-		}
-	}
-	else if( giHabitatedDistance > iDistance )
-	{ //we are within the "safe" habitated area of the creature's area of influence.  The chance of
-		//increasing the population inside this sector depends on how deep we are within the sector.
-		if( node->pLevel->ubNumCreatures < MAX_STRATEGIC_TEAM_SIZE ||
-			(node->pLevel->ubNumCreatures < 32 && node->pLevel->ubCreatureHabitat == QUEEN_LAIR) )
-		{ //there is ALWAYS a chance to habitate an interior sector, though the chances are slim for
-			//highly occupied sectors.  This chance is modified by the type of area we are in.
-			INT32 iAbsoluteMaxPopulation;
-			INT32 iMaxPopulation=-1;
-			INT32 iChanceToPopulate;
-			switch( node->pLevel->ubCreatureHabitat )
+	for (INT32 iDistance = 0; iDistance < (INT32)lair.size(); ++iDistance)
+	{
+		CREATURE_LAIR_NODE& node = lair[iDistance];
+		if( iHabitatedDistance == iDistance )
+		{	//FRONT-LINE CONDITIONS -- consider expansion or frontline fortification.  The formulae used
+			//in this sector are geared towards outer expansion.
+			//we have reached the distance limitation for the spreading.  We will determine if
+			//the area is populated enough to spread further.  The minimum population must be 4 before
+			//spreading is even considered.
+			if( node.ubNumCreatures*10 - 10 <= (INT32)Random( 60 ) )
 			{
-				case QUEEN_LAIR: //Defend the queen bonus
-					iAbsoluteMaxPopulation = 32;
-					break;
-				case LAIR: //Smaller defend the queen bonus
-					iAbsoluteMaxPopulation = 18;
-					break;
-				case LAIR_ENTRANCE: //Smallest defend the queen bonus
-					iAbsoluteMaxPopulation = 15;
-					break;
-				case INNER_MINE: //neg bonus -- actually promotes expansion over population, and decrease max pop here.
-					iAbsoluteMaxPopulation = 12;
-					break;
-				case OUTER_MINE: //neg bonus -- actually promotes expansion over population, and decrease max pop here.
-					iAbsoluteMaxPopulation = 10;
-					break;
-				case FEEDING_GROUNDS: //get free food bonus!  yummy humans :)
-					iAbsoluteMaxPopulation = 15;
-					break;
-				case MINE_EXIT:	//close access to humans (don't want to overwhelm them)
-					iAbsoluteMaxPopulation = 10;
-					break;
-				default:
-					SLOGA("PlaceNewCreature: invalid habitat type");
-					return FALSE;
+				// x<=1 100%
+				// x==2  83%
+				// x==3  67%
+				// x==4  50%
+				// x==5  33%
+				// x==6  17%
+				// x>=7   0%
+				node.ubNumCreatures++;
+				return iDistance;
 			}
-
-			switch( gGameOptions.ubDifficultyLevel )
-			{
-				case DIF_LEVEL_EASY: //50%
-					iAbsoluteMaxPopulation /= 2; //Half
-					break;
-				case DIF_LEVEL_MEDIUM: //80%
-					iAbsoluteMaxPopulation = iAbsoluteMaxPopulation * 4 / 5;
-					break;
-				case DIF_LEVEL_HARD: //100%
-					break;
-			}
-
-			//Calculate the desired max population percentage based purely on current distant to creature range.
-			//The closer we are to the lair, the closer this value will be to 100.
-			iMaxPopulation = 100 - iDistance * 100 / giHabitatedDistance;
-			iMaxPopulation = std::max(iMaxPopulation, 25);
-			//Now, convert the previous value into a numeric population.
-			iMaxPopulation = iAbsoluteMaxPopulation * iMaxPopulation / 100;
-			iMaxPopulation = std::max(iMaxPopulation, 4);
-
-
-			//The chance to populate a sector is higher for lower populations.  This is calculated on
-			//the ratio of current population to the max population.
-			iChanceToPopulate = 100 - node->pLevel->ubNumCreatures * 100 / iMaxPopulation;
-
-			if( !node->pLevel->ubNumCreatures || (iChanceToPopulate > (INT32)Random( 100 )
-					&& iMaxPopulation > node->pLevel->ubNumCreatures) )
-			{
-				AddCreatureToNode( node );
-				return TRUE;
+		}
+		else if( iHabitatedDistance > iDistance )
+		{ //we are within the "safe" habitated area of the creature's area of influence.  The chance of
+			//increasing the population inside this sector depends on how deep we are within the sector.
+			if( node.ubNumCreatures < MAX_STRATEGIC_TEAM_SIZE ||
+				(node.ubNumCreatures < 32 && node.ubCreatureHabitat == QUEEN_LAIR) )
+			{ //there is ALWAYS a chance to habitate an interior sector, though the chances are slim for
+				//highly occupied sectors.  This chance is modified by the type of area we are in.
+				INT32 iAbsoluteMaxPopulation;
+				INT32 iMaxPopulation=-1;
+				INT32 iChanceToPopulate;
+				switch( node.ubCreatureHabitat )
+				{
+					case QUEEN_LAIR: //Defend the queen bonus
+						iAbsoluteMaxPopulation = 32;
+						break;
+					case LAIR: //Smaller defend the queen bonus
+						iAbsoluteMaxPopulation = 18;
+						break;
+					case LAIR_ENTRANCE: //Smallest defend the queen bonus
+						iAbsoluteMaxPopulation = 15;
+						break;
+					case INNER_MINE: //neg bonus -- actually promotes expansion over population, and decrease max pop here.
+						iAbsoluteMaxPopulation = 12;
+						break;
+					case OUTER_MINE: //neg bonus -- actually promotes expansion over population, and decrease max pop here.
+						iAbsoluteMaxPopulation = 10;
+						break;
+					case FEEDING_GROUNDS: //get free food bonus!  yummy humans :)
+						iAbsoluteMaxPopulation = 15;
+						break;
+					case MINE_EXIT:	//close access to humans (don't want to overwhelm them)
+						iAbsoluteMaxPopulation = 10;
+						break;
+					default:
+						SLOGA("PlaceCreatureInLair: invalid habitat type");
+						return -1;
+				}
+
+				switch( ubDifficultyLevel )
+				{
+					case DIF_LEVEL_EASY: //50%
+						iAbsoluteMaxPopulation /= 2; //Half
+						break;
+					case DIF_LEVEL_MEDIUM: //80%
+						iAbsoluteMaxPopulation = iAbsoluteMaxPopulation * 4 / 5;
+						break;
+					case DIF_LEVEL_HARD: //100%
+						break;
+				}
+
+				//Calculate the desired max population percentage based purely on current distant to creature range.
+				//The closer we are to the lair, the closer this value will be to 100.
+				iMaxPopulation = 100 - iDistance * 100 / iHabitatedDistance;
+				iMaxPopulation = std::max(iMaxPopulation, 25);
+				//Now, convert the previous value into a numeric population.
+				iMaxPopulation = iAbsoluteMaxPopulation * iMaxPopulation / 100;
+				iMaxPopulation = std::max(iMaxPopulation, 4);
+
+
+				//The chance to populate a sector is higher for lower populations.  This is calculated on
+				//the ratio of current population to the max population.
+				iChanceToPopulate = 100 - node.ubNumCreatures * 100 / iMaxPopulation;
+
+				if( !node.ubNumCreatures || (iChanceToPopulate > (INT32)Random( 100 )
+						&& iMaxPopulation > node.ubNumCreatures) )
+				{
+					node.ubNumCreatures++;
+					return iDistance;
+				}
 			}
 		}
+		else
+		{ //we are in a new area, so we will populate it
+			node.ubNumCreatures++;
+			iHabitatedDistance++;
+			return iDistance;
+		}
 	}
-	else
-	{ //we are in a new area, so we will populate it
-		AddCreatureToNode( node );
-		giHabitatedDistance++;
-		return TRUE;
-	}
-	if( PlaceNewCreature( node->next, iDistance + 1 ) )
-		return TRUE;
-	return FALSE;
+	return -1;
 }
 
-void SpreadCreatures()
+
+UINT16 SpreadCreaturesInLair(std::vector<CREATURE_LAIR_NODE>& lair, INT32& iHabitatedDistance, UINT8 const ubDifficultyLevel)
 {
 	UINT16 usNewCreatures=0;
-
-	if (giLairID == -1) return;
+	UINT16 usPlaced = 0;
 
 	//queen just produced a litter of creature larvae.  Let's do some spreading now.
-	switch( gGameOptions.ubDifficultyLevel )
+	switch( ubDifficultyLevel )
 	{
 		case DIF_LEVEL_EASY:
 			usNewCreatures = (UINT16)(EASY_QUEEN_REPRODUCTION_BASE + Random( 1 + EASY_QUEEN_REPRODUCTION_BONUS ));
@@ -424,7 +433,33 @@ void SpreadCreatures()
 		//Note, this function can and will fail if the population gets dense.  This is a necessary
 		//feature.  Otherwise, the queen would fill all the cave levels with MAX_STRATEGIC_TEAM_SIZE monsters, and that would
 		//be bad.
-		PlaceNewCreature( gLair, 0 );
+		if (PlaceCreatureInLair(lair, iHabitatedDistance, ubDifficultyLevel) != -1) ++usPlaced;
+	}
+	return usPlaced;
+}
+
+
+void SpreadCreatures()
+{
+	if (giLairID == -1) return;
+
+	//Take a snapshot of the lair, the populations change outside of spreading as creatures
+	//die in battle or leave for a town attack.
+	std::vector<CREATURE_LAIR_NODE> lair;
+	lair.reserve(gLair.size());
+	for (UNDERGROUND_SECTORINFO const* pLevel : gLair)
+	{
+		lair.push_back(CREATURE_LAIR_NODE{ pLevel->ubCreatureHabitat, pLevel->ubNumCreatures });
+	}
+
+	SpreadCreaturesInLair(lair, giHabitatedDistance, gGameOptions.ubDifficultyLevel);
+
+	for (size_t i = 0; i < lair.size(); ++i)
+	{
+		if (lair[i].ubNumCreatures != gLair[i]->ubNumCreatures)
+		{
+			SetLairSectorPopulation(gLair[i], lair[i].ubNumCreatures);
+		}
 	}
 }
 
@@ -536,7 +571,7 @@ void CreatureAttackTown(UINT8 ubSectorID, BOOLEAN fSpecificSector)
 	if (!fSpecificSector)
 	{
 		//Record the number of creatures in the sector.
-		pSector = FindUnderGroundSector(ubSector);
+		pSector = FindCreatureSector(ubSector);
 		if( !pSector )
 		{
 			CreatureAttackTown(ubSectorID, TRUE);
@@ -617,25 +652,14 @@ void CreatureAttackTown(UINT8 ubSectorID, BOOLEAN fSpecificSector)
 }
 
 
-static void DeleteDirectiveNode(CREATURE_DIRECTIVE** node)
-{
-	if( (*node)->next )
-		DeleteDirectiveNode( &((*node)->next) );
-	delete *node;
-	*node = NULL;
-}
-
-//Recursively delete all nodes (from the top down).
 void DeleteCreatureDirectives()
 {
-	if( gLair )
-		DeleteDirectiveNode( &gLair );
+	ClearCreatureLair();
 	giLairID = 0;
 }
 
 void EndCreatureQuest()
 {
-	CREATURE_DIRECTIVE *curr;
 	UNDERGROUND_SECTORINFO *pSector;
 	INT32 i;
 
@@ -646,19 +670,14 @@ void EndCreatureQuest()
 
 	//Also nuke all of the creatures in all of the other mine sectors.  This
 	//is keyed on the fact that the queen monster is killed.
-	curr = gLair;
-	if( curr )
-	{ //skip first node (there could be other creatures around.
-		curr = curr->next;
-	}
-	while( curr )
+	//skip first node (there could be other creatures around.
+	for (size_t uiNode = 1; uiNode < gLair.size(); ++uiNode)
 	{
-		curr->pLevel->ubNumCreatures = 0;
-		curr = curr->next;
+		gLair[uiNode]->ubNumCreatures = 0;
 	}
 
 	//Remove the creatures that are trapped underneath Tixa
-	pSector = FindUnderGroundSector(SGPSector(9, 10, 2));
+	pSector = FindCreatureSector(SGPSector(9, 10, 2));
 	if( pSector )
 	{
 		pSector->ubNumCreatures = 0;
@@ -678,7 +697,7 @@ static UINT8 CreaturesInUndergroundSector(UINT8 ubSectorID, UINT8 ubSectorZ)
 {
 	UNDERGROUND_SECTORINFO *pSector;
 	SGPSector ubSector = SGPSector::FromSectorID(ubSectorID, ubSectorZ);
-	pSector = FindUnderGroundSector(ubSector);
+	pSector = FindCreatureSector(ubSector);
 	if( pSector )
 		return pSector->ubNumCreatures;
 	return 0;
@@ -816,7 +835,7 @@ BOOLEAN PrepareCreaturesForBattle()
 
 		if (!gWorldSector.z)
 			return FALSE;  //Creatures don't attack overworld with this battle code.
-		pSector = FindUnderGroundSector(gWorldSector);
+		pSector = FindCreatureSector(gWorldSector);
 		if( !pSector )
 		{
 			return FALSE;
@@ -926,7 +945,7 @@ BOOLEAN PrepareCreaturesForBattle()
 	if (gWorldSector.z)
 	{
 		UNDERGROUND_SECTORINFO *pUndergroundSector;
-		pUndergroundSector = FindUnderGroundSector(gWorldSector);
+		pUndergroundSector = FindCreatureSector(gWorldSector);
 		if( !pUndergroundSector )
 		{ //No info?!!!!!
 			SLOGA("Please report underground sector you are in or going to and send save if possible." );
@@ -1049,22 +1068,15 @@ BOOLEAN PlayerGroupIsInACreatureInfestedMine()
 		return FALSE;
 	}
 
-	//Lair is active, so look for live soldier in any creature level
-	CREATURE_DIRECTIVE *curr = gLair;
-	while( curr )
+	//Lair is active, so look for live soldier in any creature level (mine sectors that are infectible)
+	CFOR_EACH_IN_TEAM(pSoldier, OUR_TEAM)
 	{
-		//Loop through all the creature directives (mine sectors that are infectible) and
-		//see if players are there.
-		CFOR_EACH_IN_TEAM(pSoldier, OUR_TEAM)
+		if (pSoldier->bLife != 0 &&
+				!pSoldier->fBetweenSectors &&
+				FindLairSector(pSoldier->sSector))
 		{
-			if (pSoldier->bLife    != 0 &&
-					pSoldier->sSector == curr->pLevel->ubSector &&
-					!pSoldier->fBetweenSectors )
-			{
-				return TRUE;
-			}
+			return TRUE;
 		}
-		curr = curr->next;
 	}
 
 	//Lair is active, but no mercs are in these sectors
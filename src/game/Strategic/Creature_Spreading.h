@@ -4,6 +4,8 @@
 #include "JA2Types.h"
 #include "Types.h"
 
+#include <vector>
+
 
 void InitCreatureQuest(void);
 void SpreadCreatures(void);
@@ -65,6 +67,27 @@ void DetermineCreatureTownCompositionBasedOnTacticalInformation(UINT8 *pubNumCre
 
 BOOLEAN PlayerGroupIsInACreatureInfestedMine(void);
 
+// A sector of the creature lair as seen by the spreading, the lair is a
+// chain of these ordered by the distance from the queen.
+struct CREATURE_LAIR_NODE
+{
+	UINT8 ubCreatureHabitat;
+	UINT8 ubNumCreatures;
+};
+
+/* Try to place one new creature in the lair, going outwards from the queen.
+ * Returns the index of the node that received it, or -1 if the lair is too
+ * crowded.  iHabitatedDistance grows when a new sector gets populated.  Only
+ * Random() is consulted, so the result is deterministic for a seeded engine. */
+INT32 PlaceCreatureInLair(std::vector<CREATURE_LAIR_NODE>& lair, INT32& iHabitatedDistance, UINT8 ubDifficultyLevel);
+
+// Let the queen produce one litter and spread it over the lair.  Returns the
+// number of creatures that found a place.
+UINT16 SpreadCreaturesInLair(std::vector<CREATURE_LAIR_NODE>& lair, INT32& iHabitatedDistance, UINT8 ubDifficultyLevel);
+
+// The number of minutes between two spreads for the given difficulty
+UINT32 GetCreatureSpreadTime(UINT8 ubDifficultyLevel);
+
 void EndCreatureQuest(void);
 
 #endif
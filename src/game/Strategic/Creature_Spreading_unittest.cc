@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include "Creature_Spreading.h"
+#include "GameSettings.h"
+#include "Random.h"
+#include "StrategicMap.h"
+
+
+static std::vector<CREATURE_LAIR_NODE> MakeLair()
+{
+	return {
+		{ QUEEN_LAIR, 1 }, { LAIR, 0 }, { LAIR, 0 }, { LAIR_ENTRANCE, 0 },
+		{ INNER_MINE, 0 }, { INNER_MINE, 0 }, { OUTER_MINE, 0 }, { MINE_EXIT, 0 }
+	};
+}
+
+// Spread as often as the strategic event would during the given number of days
+static UINT32 SimulateDays(std::vector<CREATURE_LAIR_NODE>& lair, INT32& iHabitatedDistance, UINT8 const ubDifficultyLevel, UINT32 const uiDays)
+{
+	UINT32 uiPlaced = 0;
+	for (UINT32 uiMinute = 0; uiMinute < uiDays * 1440; uiMinute += GetCreatureSpreadTime(ubDifficultyLevel))
+	{
+		uiPlaced += SpreadCreaturesInLair(lair, iHabitatedDistance, ubDifficultyLevel);
+	}
+	return uiPlaced;
+}
+
+static UINT32 Population(std::vector<CREATURE_LAIR_NODE> const& lair)
+{
+	UINT32 uiTotal = 0;
+	for (CREATURE_LAIR_NODE const& node : lair) uiTotal += node.ubNumCreatures;
+	return uiTotal;
+}
+
+
+TEST(CreatureSpreading, deterministicForSeed)
+{
+	std::vector<CREATURE_LAIR_NODE> first = MakeLair();
+	std::vector<CREATURE_LAIR_NODE> second = MakeLair();
+	INT32 iFirstDistance = 0;
+	INT32 iSecondDistance = 0;
+
+	gRandomEngine.seed(1234);
+	SimulateDays(first, iFirstDistance, DIF_LEVEL_MEDIUM, 10);
+	gRandomEngine.seed(1234);
+	SimulateDays(second, iSecondDistance, DIF_LEVEL_MEDIUM, 10);
+
+	EXPECT_EQ(iFirstDistance, iSecondDistance);
+	for (size_t i = 0; i < first.size(); ++i)
+	{
+		EXPECT_EQ(first[i].ubNumCreatures, second[i].ubNumCreatures);
+	}
+}
+
+TEST(CreatureSpreading, populationSettles)
+{
+	UINT32 uiPopulation[NUM_DIF_LEVELS + 1] = {};
+	for (UINT8 ubDifficulty = DIF_LEVEL_EASY; ubDifficulty <= DIF_LEVEL_HARD; ++ubDifficulty)
+	{
+		gRandomEngine.seed(ubDifficulty);
+		std::vector<CREATURE_LAIR_NODE> lair = MakeLair();
+		INT32 iHabitatedDistance = 0;
+
+		// after two months the whole lair is populated and the queen has run out of room
+		SimulateDays(lair, iHabitatedDistance, ubDifficulty, 60);
+		EXPECT_EQ(iHabitatedDistance, (INT32)lair.size() - 1);
+		EXPECT_EQ(SimulateDays(lair, iHabitatedDistance, ubDifficulty, 30), 0u);
+
+		EXPECT_LE(lair[0].ubNumCreatures, 32);
+		for (size_t i = 1; i < lair.size(); ++i)
+		{
+			EXPECT_GT(lair[i].ubNumCreatures, 0);
+			EXPECT_LE(lair[i].ubNumCreatures, MAX_STRATEGIC_TEAM_SIZE);
+		}
+		uiPopulation[ubDifficulty] = Population(lair);
+	}
+	EXPECT_LT(uiPopulation[DIF_LEVEL_EASY], uiPopulation[DIF_LEVEL_MEDIUM]);
+	EXPECT_LT(uiPopulation[DIF_LEVEL_MEDIUM], uiPopulation[DIF_LEVEL_HARD]);
+}
@@ -49,6 +49,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <iterator>
 #include <vector>
 
 // status bar colors
@@ -112,6 +113,23 @@ static GUIButtonRef guiMapInvenButton[3];
 
 static BOOLEAN gfCheckForCursorOverMapSectorInventoryItem = FALSE;
 
+// the strings shown for the object in each slot of the current page, only
+// rebuilt when the object in the slot changes
+struct MAP_INVENTORY_SLOT_CACHE
+{
+	BOOLEAN    fValid;
+	BOOLEAN    fHelpTextDirty;
+	// the parts of the object the name and help text are made of
+	UINT16     usItem;
+	UINT8      ubNumberOfObjects;
+	UINT32     uiMoneyAmount;
+	UINT8      ubImprintID;
+	UINT16     usAttachItem[MAX_ATTACHMENTS];
+	ST::string name;
+	ST::string help;
+};
+static MAP_INVENTORY_SLOT_CACHE gMapInventorySlotCache[MAP_INVENTORY_POOL_SLOT_COUNT];
+
 
 // load the background panel graphics for inventory
 void LoadInventoryPoolGraphic(void)
@@ -177,6 +195,49 @@ void BlitInventoryPoolGraphic( void )
 }
 
 
+static void InvalidateMapInventorySlotCache(void)
+{
+	FOR_EACH(MAP_INVENTORY_SLOT_CACHE, i, gMapInventorySlotCache) i->fValid = FALSE;
+}
+
+
+static const MAP_INVENTORY_SLOT_CACHE& GetMapInventorySlotCache(INT32 const iCurrentSlot, OBJECTTYPE const& o)
+{
+	// the money amount shares its bytes with the status of other items
+	UINT32 const money = GCM->getItem(o.usItem)->getItemClass() == IC_MONEY ? o.uiMoneyAmount : 0;
+
+	MAP_INVENTORY_SLOT_CACHE& c = gMapInventorySlotCache[iCurrentSlot];
+	if (c.fValid &&
+			c.usItem            == o.usItem            &&
+			c.ubNumberOfObjects == o.ubNumberOfObjects &&
+			c.uiMoneyAmount     == money               &&
+			c.ubImprintID       == o.ubImprintID       &&
+			std::equal(std::begin(c.usAttachItem), std::end(c.usAttachItem), std::begin(o.usAttachItem)))
+	{
+		return c;
+	}
+
+	c.fValid            = TRUE;
+	c.fHelpTextDirty    = TRUE;
+	c.usItem            = o.usItem;
+	c.ubNumberOfObjects = o.ubNumberOfObjects;
+	c.uiMoneyAmount     = money;
+	c.ubImprintID       = o.ubImprintID;
+	std::copy(std::begin(o.usAttachItem), std::end(o.usAttachItem), std::begin(c.usAttachItem));
+	if (o.ubNumberOfObjects > 0)
+	{
+		c.name = ReduceStringLength(GCM->getItem(o.usItem)->getShortName(), g_sector_inv_name_box.w, MAP_IVEN_FONT);
+		c.help = GetHelpTextForItem(o);
+	}
+	else
+	{
+		c.name.clear();
+		c.help.clear();
+	}
+	return c;
+}
+
+
 static BOOLEAN RenderItemInPoolSlot(INT32 iCurrentSlot, INT32 iFirstSlotOnPage);
 
 
@@ -229,7 +290,7 @@ static BOOLEAN RenderItemInPoolSlot(INT32 iCurrentSlot, INT32 iFirstSlotOnPage)
 
 	// the name
 	const SGPBox* const name_box = &g_sector_inv_name_box;
-	auto sString = ReduceStringLength(GCM->getItem(item.o.usItem)->getShortName(), name_box->w, MAP_IVEN_FONT);
+	const ST::string& sString = GetMapInventorySlotCache(iCurrentSlot, item.o).name;
 
 	SetFontAttributes(MAP_IVEN_FONT, FONT_WHITE);
 
@@ -246,22 +307,20 @@ static BOOLEAN RenderItemInPoolSlot(INT32 iCurrentSlot, INT32 iFirstSlotOnPage)
 
 static void UpdateHelpTextForInvnentoryStashSlots(void)
 {
-	ST::string pStr;
 	INT32 iCounter = 0;
 	INT32 iFirstSlotOnPage = ( iCurrentInventoryPoolPage * MAP_INVENTORY_POOL_SLOT_COUNT );
 
 
-	// run through list of items in slots and update help text for mouse regions
+	// run through list of items in slots and update help text for mouse regions whose item changed
 	for( iCounter = 0; iCounter < MAP_INVENTORY_POOL_SLOT_COUNT; iCounter++ )
 	{
-		ST::string help;
-		OBJECTTYPE const& o    = pInventoryPoolList[iCounter + iFirstSlotOnPage].o;
-		if  (o.ubNumberOfObjects > 0)
-		{
-			pStr = GetHelpTextForItem(o);
-			help = pStr;
-		}
-		MapInventoryPoolSlots[iCounter].SetFastHelpText(help);
+		OBJECTTYPE const& o = pInventoryPoolList[iCounter + iFirstSlotOnPage].o;
+		MAP_INVENTORY_SLOT_CACHE& c = gMapInventorySlotCache[iCounter];
+		GetMapInventorySlotCache(iCounter, o);
+		if (!c.fHelpTextDirty) continue;
+
+		MapInventoryPoolSlots[iCounter].SetFastHelpText(c.help);
+		c.fHelpTextDirty = FALSE;
 	}
 }
 
@@ -487,6 +546,9 @@ static void CreateMapInventoryPoolSlots(void)
 		MSYS_DefineRegion(r, x, y, x + w - 1, y + h - 1, MSYS_PRIORITY_HIGH, MSYS_NO_CURSOR, MapInvenPoolSlotsMove, MouseCallbackPrimarySecondary(MapInvenPoolSlotsPrimary, MapInvenPoolSlotsSecondary, MapInvenPoolSlotsScroll));
 		MSYS_SetRegionUserData(r, 0, i);
 	}
+
+	// the new regions have no help text yet
+	InvalidateMapInventorySlotCache();
 }
 
 
@@ -733,6 +795,7 @@ static void DestroyStash(void)
 	// clear out stash
 	pInventoryPoolList.clear();
 	pUnSeenItems.clear();
+	InvalidateMapInventorySlotCache();
 }
 
 
@@ -101,6 +101,7 @@ BOOLEAN SetThisSectorAsPlayerControlled(const SGPSector& sMap, BOOLEAN fConteste
 		fWasEnemyControlled = StrategicMap[ usMapSector ].fEnemyControlled;
 
 		StrategicMap[ usMapSector ].fEnemyControlled = FALSE;
+		InvalidateMineTownControl();
 
 		bTownId = StrategicMap[ usMapSector ].bNameId;
 
@@ -240,6 +241,7 @@ BOOLEAN SetThisSectorAsEnemyControlled(const SGPSector& sec)
 		fWasPlayerControlled = !StrategicMap[ usMapSector ].fEnemyControlled;
 
 		StrategicMap[ usMapSector ].fEnemyControlled = TRUE;
+		InvalidateMineTownControl();
 
 		// if player lost control to the enemy
 		if ( fWasPlayerControlled )
@@ -6,6 +6,7 @@
 #include "LoadSaveUndergroundSectorInfo.h"
 #include "Queen_Command.h"
 #include "Strategic_Event_Handler.h"
+#include "Strategic_Mines.h"
 #include "Overhead_Types.h"
 #include "StrategicMap.h"
 #include "Soldier_Init_List.h"
@@ -560,6 +561,7 @@ static void PrepareEnemyForUndergroundBattle()
 void ProcessQueenCmdImplicationsOfDeath(const SOLDIERTYPE* const pSoldier)
 {
 	EvaluateDeathEffectsToSoldierInitList(*pSoldier);
+	InvalidateMineTownControl();
 
 	switch( pSoldier->ubProfile )
 	{
@@ -2238,6 +2238,7 @@ void SetupNewStrategicGame()
 	{
 		i->fEnemyControlled = TRUE;
 	}
+	InvalidateMineTownControl();
 
 	InitNewGameClock();
 	DeleteAllStrategicEvents();
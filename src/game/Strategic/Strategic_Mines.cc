@@ -45,6 +45,19 @@
 // this table holds mine values that change during the course of the game and must be saved
 std::vector<MINE_STATUS_TYPE> gMineStatus;
 
+// How much of the town of each mine the player controls. Counting that walks
+// the town sectors and the enemy groups in them, and the map screen asks for
+// it several times per frame. Sectors changing hands, enemies dying, enemy
+// groups arriving or being removed invalidate the cache right away, anything
+// else that happens as game time passes is picked up with the next minute.
+struct MINE_TOWN_CONTROL
+{
+	UINT8 ubSectors;
+	UINT8 ubSectorsUnderControl;
+};
+static std::vector<MINE_TOWN_CONTROL> gMineTownControl;
+static UINT32 guiMineTownControlTime;
+
 struct HEAD_MINER_TYPE
 {
 	UINT16 usProfileId;
@@ -65,6 +78,8 @@ static const HEAD_MINER_TYPE gHeadMinerData[NUM_HEAD_MINERS] =
 
 void InitializeMines( void )
 {
+	InvalidateMineTownControl();
+
 	UINT8 ubMineIndex;
 	MINE_STATUS_TYPE *pMineStatus;
 	UINT8 ubMineProductionIncreases;
@@ -292,6 +307,13 @@ static void AddMineHistoryEvent(UINT8 const event, UINT const mine_id)
 }
 
 
+// max removal rate of a mine that is running out, all fractions are rounded UP to the next REMOVAL_RATE_INCREMENT
+static UINT32 GetRunningOutRemovalRate(UINT32 const uiRemainingOreSupply)
+{
+	return (UINT32) (((FLOAT) uiRemainingOreSupply / 10) / REMOVAL_RATE_INCREMENT + 0.9999) * REMOVAL_RATE_INCREMENT;
+}
+
+
 // remove actual ore from mine
 static UINT32 ExtractOreFromMine(UINT8 ubMineIndex, UINT32 uiAmount)
 {
@@ -338,8 +360,7 @@ static UINT32 ExtractOreFromMine(UINT8 ubMineIndex, UINT32 uiAmount)
 		{
 			gMineStatus[ ubMineIndex ].fRunningOut = TRUE;
 
-			// round all fractions UP to the next REMOVAL_RATE_INCREMENT
-			gMineStatus[ ubMineIndex ].uiMaxRemovalRate = (UINT32) (((FLOAT) gMineStatus[ ubMineIndex ].uiRemainingOreSupply / 10) / REMOVAL_RATE_INCREMENT + 0.9999) * REMOVAL_RATE_INCREMENT;
+			gMineStatus[ ubMineIndex ].uiMaxRemovalRate = GetRunningOutRemovalRate(gMineStatus[ ubMineIndex ].uiRemainingOreSupply);
 
 
 			// if we control it
@@ -361,6 +382,29 @@ static UINT32 ExtractOreFromMine(UINT8 ubMineIndex, UINT32 uiAmount)
 }
 
 
+void InvalidateMineTownControl()
+{
+	gMineTownControl.clear();
+}
+
+
+static MINE_TOWN_CONTROL const& GetMineTownControl(UINT8 const ubMineIndex)
+{
+	UINT32 const now = GetWorldTotalMin();
+	if (gMineTownControl.empty() || guiMineTownControlTime != now)
+	{
+		gMineTownControl.clear();
+		for (UINT8 i = 0; i < gMineStatus.size(); ++i)
+		{
+			INT8 const bTownId = GCM->getMine(i)->associatedTownId;
+			gMineTownControl.push_back(MINE_TOWN_CONTROL{ GetTownSectorSize(bTownId), GetTownSectorsUnderControl(bTownId) });
+		}
+		guiMineTownControlTime = now;
+	}
+	return gMineTownControl[ubMineIndex];
+}
+
+
 // Get the available player workforce for the mine [0,100]
 static INT32 GetAvailableWorkForceForMineForPlayer(UINT8 ubMineIndex)
 {
@@ -388,9 +432,10 @@ static INT32 GetAvailableWorkForceForMineForPlayer(UINT8 ubMineIndex)
 
 	bTownId = mine->associatedTownId;
 
-	UINT8 numSectors = GetTownSectorSize( bTownId );
+	MINE_TOWN_CONTROL const& control = GetMineTownControl(ubMineIndex);
+	UINT8 numSectors = control.ubSectors;
 	Assert(numSectors > 0);
-	UINT8 numSectorsUnderControl = GetTownSectorsUnderControl( bTownId );
+	UINT8 numSectorsUnderControl = control.ubSectorsUnderControl;
 	Assert(numSectorsUnderControl <= numSectors);
 
 	// get workforce size (is 0-100 based on local town's loyalty)
@@ -423,9 +468,10 @@ static INT32 GetAvailableWorkForceForMineForEnemy(UINT8 ubMineIndex)
 
 	bTownId = mine->associatedTownId;
 
-	UINT8 numSectors = GetTownSectorSize( bTownId );
+	MINE_TOWN_CONTROL const& control = GetMineTownControl(ubMineIndex);
+	UINT8 numSectors = control.ubSectors;
 	Assert(numSectors > 0);
-	UINT8 numSectorsUnderControl = GetTownSectorsUnderControl( bTownId );
+	UINT8 numSectorsUnderControl = control.ubSectorsUnderControl;
 	Assert(numSectorsUnderControl <= numSectors);
 
 	// get workforce size (is 0-100 based on REVERSE of local town's loyalty)
@@ -576,6 +622,54 @@ INT32 PredictIncomeFromPlayerMines( void )
 }
 
 
+std::vector<UINT32> ForecastMineIncome(MINE_FORECAST_INPUT const& mine, UINT8 const days)
+{
+	std::vector<UINT32> income(days, 0);
+	UINT32 remaining = mine.uiRemainingOreSupply;
+	UINT32 rate      = mine.uiMaxRemovalRate;
+	for (UINT32& day : income)
+	{
+		for (UINT8 period = 0; period < MINE_PRODUCTION_NUMBER_OF_PERIODS; ++period)
+		{
+			// same steps as MineAMine() and ExtractOreFromMine()
+			UINT32 const amount = rate * mine.iWorkForce / 100;
+			if (amount == 0) return income;
+
+			if (amount >= remaining)
+			{
+				// the mine is exhausted
+				day += remaining;
+				return income;
+			}
+
+			day       += amount;
+			remaining -= amount;
+			if (remaining < mine.uiOreRunningOutPoint)
+			{
+				rate = GetRunningOutRemovalRate(remaining);
+			}
+		}
+	}
+	return income;
+}
+
+
+std::vector<UINT32> ForecastIncomeFromPlayerMines(UINT8 const days)
+{
+	std::vector<UINT32> total(days, 0);
+	for (UINT8 i = 0; i < gMineStatus.size(); ++i)
+	{
+		MINE_STATUS_TYPE const& m = gMineStatus[i];
+		if (m.fEmpty || !PlayerControlsMine(i)) continue;
+
+		MINE_FORECAST_INPUT const input{ m.uiRemainingOreSupply, m.uiOreRunningOutPoint, m.uiMaxRemovalRate, GetAvailableWorkForceForMineForPlayer(i) };
+		std::vector<UINT32> const income = ForecastMineIncome(input, days);
+		for (UINT8 day = 0; day < days; ++day) total[day] += income[day];
+	}
+	return total;
+}
+
+
 INT32 CalcMaxPlayerIncomeFromMines()
 {
 	INT32 total = 0;
@@ -656,6 +750,8 @@ void SaveMineStatusToSaveGameFile(HWFILE const f)
 
 void LoadMineStatusFromSavedGameFile(HWFILE const f)
 {
+	InvalidateMineTownControl();
+
 	// Save game breaks if the number of mines changes, as we do not
 	// store the number of mines when the game was saved.
 	gMineStatus.resize(GCM->getMines().size());
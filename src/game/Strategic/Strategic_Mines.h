@@ -5,6 +5,8 @@
 
 #include "Types.h"
 
+#include <vector>
+
 
 // the mines
 enum MineID
@@ -103,6 +105,27 @@ UINT32 PredictDailyIncomeFromAMine(INT8 mine_id);
  * control and 100% loyalty. */
 INT32 CalcMaxPlayerIncomeFromMines();
 
+// production state of a mine as seen by ForecastMineIncome()
+struct MINE_FORECAST_INPUT
+{
+	UINT32 uiRemainingOreSupply;
+	UINT32 uiOreRunningOutPoint;
+	UINT32 uiMaxRemovalRate;
+	INT32  iWorkForce; // part of the workforce working for the player [0,100]
+};
+
+/* Predict the income from a mine for each of the next days, assuming the
+ * workforce stays as it is. Unlike PredictDailyIncomeFromAMine() this follows
+ * the ore running out, including the lower removal rate that comes with it. */
+std::vector<UINT32> ForecastMineIncome(MINE_FORECAST_INPUT const&, UINT8 days);
+
+// daily income forecast summed up over all mines the player controls
+std::vector<UINT32> ForecastIncomeFromPlayerMines(UINT8 days);
+
+// forget which parts of the mining towns the player controls, call when a sector
+// changes hands or the enemies in it change
+void InvalidateMineTownControl();
+
 // get index of this mine, return -1 if no mine found
 INT8 GetMineIndexForSector(UINT8 sector);
 
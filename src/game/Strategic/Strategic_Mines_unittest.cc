@@ -0,0 +1,29 @@
+#include "gtest/gtest.h"
+
+#include "Strategic_Mines.h"
+
+
+TEST(StrategicMines, forecastSteadyProduction)
+{
+	MINE_FORECAST_INPUT const mine{ 100000, 0, 1000, 50 };
+	EXPECT_EQ(ForecastMineIncome(mine, 3), (std::vector<UINT32>{ 2000, 2000, 2000 }));
+}
+
+TEST(StrategicMines, forecastMineRunningEmpty)
+{
+	MINE_FORECAST_INPUT const mine{ 5000, 0, 1000, 100 };
+	EXPECT_EQ(ForecastMineIncome(mine, 3), (std::vector<UINT32>{ 4000, 1000, 0 }));
+}
+
+TEST(StrategicMines, forecastMineRunningOut)
+{
+	// once below the running out point the removal rate drops with the remaining ore
+	MINE_FORECAST_INPUT const mine{ 20000, 19000, 2000, 100 };
+	EXPECT_EQ(ForecastMineIncome(mine, 2), (std::vector<UINT32>{ 2000 + 2000 + 1750 + 1500, 1500 + 1250 + 1000 + 1000 }));
+}
+
+TEST(StrategicMines, forecastWithoutWorkforce)
+{
+	MINE_FORECAST_INPUT const mine{ 100000, 0, 1000, 0 };
+	EXPECT_EQ(ForecastMineIncome(mine, 2), (std::vector<UINT32>{ 0, 0 }));
+}
@@ -36,6 +36,7 @@
 #include "Strategic.h"
 #include "StrategicMap_Secrets.h"
 #include "Strategic_AI.h"
+#include "Strategic_Mines.h"
 #include "Strategic_Pathing.h"
 #include "Tactical_Save.h"
 #include "Text.h"
@@ -1140,6 +1141,7 @@ void GroupArrivedAtSector(GROUP& g, BOOLEAN const check_for_battle, BOOLEAN cons
 	g.ubSector = cSector;
 	g.ubNext.x   = 0;
 	g.ubNext.y   = 0;
+	if (!g.fPlayer) InvalidateMineTownControl();
 
 	if (g.fPlayer)
 	{
@@ -1844,6 +1846,7 @@ void RemoveGroup(GROUP& g)
 	}
 
 	RemoveGroupFromList(&g);
+	InvalidateMineTownControl();
 
 	/* safety check: if this group is the BattleGroup, invalid the pointer */
 	if(gpBattleGroup == &g)
@@ -30,6 +30,8 @@ struct ANIMSUBTYPE
 
 //Block for anim file
 UINT16	gusAnimInst[MAX_ANIMATIONS][MAX_FRAMES_PER_ANIM];
+// Same scripts, compiled once after loading
+ANIM_SCRIPT gAnimScripts[MAX_ANIMATIONS];
 
 // OK, this array contains definitions for random animations based on bodytype, total # allowed, and what is in their hand....
 RANDOM_ANI_DEF	gRandomAnimDefs[TOTALBODYTYPES][MAX_RANDOM_ANIMS_PER_BODYTYPE];
@@ -2402,10 +2404,78 @@ void InitAnimationSurfacesPerBodytype( )
 }
 
 
+static bool IsLocalJumpCode(UINT16 const code)
+{
+	return code > 499 && code < 599;
+}
+
+
+// Follow a chain of jumps, returns the start position if the chain is broken
+static UINT8 ResolveAnimationJump(UINT16 const anim, UINT8 const start)
+{
+	UINT8 pos = start;
+	// Without a cycle every position is visited at most once
+	for (UINT32 steps = 0; steps != MAX_FRAMES_PER_ANIM; ++steps)
+	{
+		UINT16 const code = gusAnimInst[anim][pos];
+		if (!IsLocalJumpCode(code)) return pos;
+
+		if (code < 501 || code - 501 >= MAX_FRAMES_PER_ANIM)
+		{
+			SLOGD("Animation script {} jumps out of bounds at {}", anim, pos);
+			return start;
+		}
+		pos = static_cast<UINT8>(code - 501);
+	}
+
+	SLOGD("Animation script {} loops through jumps at {}", anim, start);
+	return start;
+}
+
+
+static void CompileAnimationScripts()
+{
+	for (UINT16 anim = 0; anim != MAX_ANIMATIONS; ++anim)
+	{
+		UINT16 const* const inst   = gusAnimInst[anim];
+		ANIM_SCRIPT&        script = gAnimScripts[anim];
+
+		// The return hook is only searched up to the end of the script
+		script.ubReturnHook = NO_RETURN_HOOK;
+		bool end_reached = false;
+
+		for (UINT8 i = 0; i != MAX_FRAMES_PER_ANIM; ++i)
+		{
+			UINT16 const    code = inst[i];
+			ANIM_SCRIPT_OP& op   = script.ops[i];
+
+			if (code < 399)                 op.ubType = ANIM_OP_FRAME;
+			else if (IsLocalJumpCode(code)) op.ubType = ANIM_OP_JUMP;
+			else                            op.ubType = ANIM_OP_EFFECT;
+
+			op.ubTarget = op.ubType == ANIM_OP_JUMP ? ResolveAnimationJump(anim, i) : i;
+
+			if (end_reached) continue;
+			if (code == 435)
+			{
+				script.ubReturnHook = i;
+				end_reached         = true;
+			}
+			else if (code == 999)
+			{
+				end_reached = true;
+			}
+		}
+	}
+}
+
+
 void LoadAnimationStateInstructions()
 {
 	AutoSGPFile hFile(GCM->openGameResForReading(ANIMFILENAME));
 	hFile->read(gusAnimInst, sizeof(gusAnimInst));
+
+	CompileAnimationScripts();
 }
 
 
@@ -518,6 +518,33 @@ enum AnimationStates
 
 
 extern UINT16                gusAnimInst[MAX_ANIMATIONS][MAX_FRAMES_PER_ANIM];
+
+// Classification of the codes in gusAnimInst
+enum AnimScriptOpType
+{
+	ANIM_OP_FRAME,  // display a frame and advance
+	ANIM_OP_JUMP,   // jump to another position in the same script
+	ANIM_OP_EFFECT  // anything else, has to be interpreted
+};
+
+struct ANIM_SCRIPT_OP
+{
+	UINT8 ubType;
+	// Position reached after following all jumps from this one, the position
+	// itself for anything but valid jumps
+	UINT8 ubTarget;
+};
+
+#define NO_RETURN_HOOK 0xFF
+
+// Precompiled form of one gusAnimInst script
+struct ANIM_SCRIPT
+{
+	ANIM_SCRIPT_OP ops[MAX_FRAMES_PER_ANIM];
+	UINT8          ubReturnHook; // Position of the return hook (435) or NO_RETURN_HOOK
+};
+
+extern ANIM_SCRIPT           gAnimScripts[MAX_ANIMATIONS];
 extern const ANIMCONTROLTYPE gAnimControl[NUMANIMATIONSTATES];
 
 extern const ANI_SPEED_DEF gubAnimWalkSpeeds[];
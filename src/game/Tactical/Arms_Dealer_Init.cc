@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 // To reduce memory fragmentation from frequent MemRealloc(), we allocate memory for more than one special slot each
 // time we run out of space.  Odds are that if we need one, we'll need another soon.
@@ -59,6 +60,39 @@ const DealerModel* GetDealer(UINT8 dealerID)
 	return GCM->getDealer(dealerID);
 }
 
+
+// An item a dealer sells, together with the amount he wants to keep in stock
+struct DEALER_CATALOG_ITEM
+{
+	UINT16 usItemIndex;
+	UINT8  ubMaxSupply;
+};
+
+// The items each dealer sells, in item order.  Only depends on the dealer's
+// inventory list, so it is built on first use and kept for the whole game.
+static std::vector<DEALER_CATALOG_ITEM> gArmsDealerCatalog[NUM_ARMS_DEALERS];
+static bool                             gfArmsDealerCatalogBuilt[NUM_ARMS_DEALERS];
+
+
+static std::vector<DEALER_CATALOG_ITEM> const& GetArmsDealerCatalog(ArmsDealerID const ubArmsDealer)
+{
+	std::vector<DEALER_CATALOG_ITEM>& catalog = gArmsDealerCatalog[ubArmsDealer];
+	if (gfArmsDealerCatalogBuilt[ubArmsDealer]) return catalog;
+
+	catalog.clear();
+	if (!GetDealer(ubArmsDealer)->hasFlag(ArmsDealerFlag::HAS_NO_INVENTORY))
+	{
+		for (UINT16 usItemIndex = 1; usItemIndex < MAXITEMS; ++usItemIndex)
+		{
+			//Can the item be sold by the arms dealer
+			if (!CanDealerTransactItem(ubArmsDealer, usItemIndex, FALSE)) continue;
+			catalog.push_back(DEALER_CATALOG_ITEM{ usItemIndex, static_cast<UINT8>(GetDealersMaxItemAmount(ubArmsDealer, usItemIndex)) });
+		}
+	}
+	gfArmsDealerCatalogBuilt[ubArmsDealer] = true;
+	return catalog;
+}
+
 void InitAllArmsDealers()
 {
 	//Memset all dealers' status tables to zeroes
@@ -86,7 +120,6 @@ static void ArmsDealerGetsFreshStock(ArmsDealerID, UINT16 usItemIndex, UINT8 ubN
 
 static void InitializeOneArmsDealer(ArmsDealerID const ubArmsDealer)
 {
-	UINT16 usItemIndex;
 	UINT8  ubNumItems=0;
 
 
@@ -104,20 +137,16 @@ static void InitializeOneArmsDealer(ArmsDealerID const ubArmsDealer)
 	}
 
 
-	//loop through all the item types
-	for( usItemIndex = 1; usItemIndex < MAXITEMS; usItemIndex++ )
+	//loop through all the items the arms dealer sells
+	for (DEALER_CATALOG_ITEM const& item : GetArmsDealerCatalog(ubArmsDealer))
 	{
-		//Can the item be sold by the arms dealer
-		if( CanDealerTransactItem( ubArmsDealer, usItemIndex, FALSE ) )
-		{
-			//Setup an initial amount for the items (treat items as new, how many are used isn't known yet)
-			ubNumItems = DetermineInitialInvItems( ubArmsDealer, usItemIndex, GetDealersMaxItemAmount( ubArmsDealer, usItemIndex ), FALSE );
+		//Setup an initial amount for the items (treat items as new, how many are used isn't known yet)
+		ubNumItems = DetermineInitialInvItems( ubArmsDealer, item.usItemIndex, item.ubMaxSupply, FALSE );
 
-			//if there are any initial items
-			if( ubNumItems > 0 )
-			{
-				ArmsDealerGetsFreshStock( ubArmsDealer, usItemIndex, ubNumItems );
-			}
+		//if there are any initial items
+		if( ubNumItems > 0 )
+		{
+			ArmsDealerGetsFreshStock( ubArmsDealer, item.usItemIndex, ubNumItems );
 		}
 	}
 }
@@ -348,71 +377,69 @@ void DailyCheckOnItemQuantities()
 			continue;
 
 
-		//loop through all items of the same type
-		for( usItemIndex = 1; usItemIndex < MAXITEMS; usItemIndex++ )
+		//loop through all the items the dealer sells
+		for (DEALER_CATALOG_ITEM const& item : GetArmsDealerCatalog(ubArmsDealer))
 		{
-			//if the dealer can sell the item type
-			if( CanDealerTransactItem( ubArmsDealer, usItemIndex, FALSE ) )
+			usItemIndex = item.usItemIndex;
+
+			//if there are no items on order
+			if ( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder == 0 )
 			{
-				//if there are no items on order
-				if ( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder == 0 )
+				ubMaxSupply = item.ubMaxSupply;
+
+				//if the qty on hand is half the desired amount or fewer
+				if( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubTotalItems <= (UINT32)( ubMaxSupply / 2 ) )
 				{
-					ubMaxSupply = GetDealersMaxItemAmount( ubArmsDealer, usItemIndex );
+					// remember value of the "previously eligible" flag
+					fPrevElig = gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].fPreviouslyEligible;
 
-					//if the qty on hand is half the desired amount or fewer
-					if( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubTotalItems <= (UINT32)( ubMaxSupply / 2 ) )
+					//determine if the item can be restocked (assume new, use items aren't checked for until the stuff arrives)
+					if (ItemTransactionOccurs( ubArmsDealer, usItemIndex, DEALER_BUYING, FALSE ))
 					{
-						// remember value of the "previously eligible" flag
-						fPrevElig = gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].fPreviouslyEligible;
+						// figure out how many items to reorder (items are reordered an entire batch at a time)
+						ubNumItems = HowManyItemsToReorder( ubMaxSupply, gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubTotalItems );
 
-						//determine if the item can be restocked (assume new, use items aren't checked for until the stuff arrives)
-						if (ItemTransactionOccurs( ubArmsDealer, usItemIndex, DEALER_BUYING, FALSE ))
+						// if this is the first day the player is eligible to have access to this thing
+						if ( !fPrevElig )
 						{
-							// figure out how many items to reorder (items are reordered an entire batch at a time)
-							ubNumItems = HowManyItemsToReorder( ubMaxSupply, gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubTotalItems );
-
-							// if this is the first day the player is eligible to have access to this thing
-							if ( !fPrevElig )
+							// eliminate the ordering delay and stock the items instantly!
+							// This is just a way to reward the player right away for making
+							// progress without the reordering lag...
+							ArmsDealerGetsFreshStock( ubArmsDealer, usItemIndex, ubNumItems );
+						}
+						else
+						{
+							if ( ( ubArmsDealer == ARMS_DEALER_TONY ) || ( ubArmsDealer == ARMS_DEALER_DEVIN ) )
 							{
-								// eliminate the ordering delay and stock the items instantly!
-								// This is just a way to reward the player right away for making
-								// progress without the reordering lag...
-								ArmsDealerGetsFreshStock( ubArmsDealer, usItemIndex, ubNumItems );
+								// the stuff Tony and Devin sell is imported, so it takes longer
+								// to arrive (for game balance)
+								ubReorderDays = ( UINT8) ( 2 + Random( 2 ) ); // 2-3 days
 							}
 							else
 							{
-								if ( ( ubArmsDealer == ARMS_DEALER_TONY ) || ( ubArmsDealer == ARMS_DEALER_DEVIN ) )
-								{
-									// the stuff Tony and Devin sell is imported, so it takes longer
-									// to arrive (for game balance)
-									ubReorderDays = ( UINT8) ( 2 + Random( 2 ) ); // 2-3 days
-								}
-								else
-								{
-									ubReorderDays = ( UINT8) ( 1 + Random( 2 ) ); // 1-2 days
-								}
-
-								//Determine when the inventory should arrive
-								uiArrivalDay = GetWorldDay() + ubReorderDays;	// consider changing this to minutes
-
-								// post new order
-								gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder = ubNumItems;
-								gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime = uiArrivalDay;
+								ubReorderDays = ( UINT8) ( 1 + Random( 2 ) ); // 1-2 days
 							}
+
+							//Determine when the inventory should arrive
+							uiArrivalDay = GetWorldDay() + ubReorderDays;	// consider changing this to minutes
+
+							// post new order
+							gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder = ubNumItems;
+							gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime = uiArrivalDay;
 						}
 					}
 				}
-				else //items are on order
+			}
+			else //items are on order
+			{
+				//and today is the day the items come in
+				if( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime >= GetWorldDay() )
 				{
-					//and today is the day the items come in
-					if( gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime >= GetWorldDay() )
-					{
-						ArmsDealerGetsFreshStock( ubArmsDealer, usItemIndex, gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder);
+					ArmsDealerGetsFreshStock( ubArmsDealer, usItemIndex, gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder);
 
-						//reset order
-						gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder = 0;
-						gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime = 0;
-					}
+					//reset order
+					gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].ubQtyOnOrder = 0;
+					gArmsDealersInventory[ ubArmsDealer ][ usItemIndex ].uiOrderArrivalTime = 0;
 				}
 			}
 		}
@@ -0,0 +1,237 @@
+#include "BattleSimulator.h"
+
+#include "AI.h"
+#include "AIList.h"
+#include "Bullets.h"
+#include "Dialogue_Control.h"
+#include "Event_Pump.h"
+#include "Game_Clock.h"
+#include "Init.h"
+#include "Logger.h"
+#include "Map_Information.h"
+#include "Overhead.h"
+#include "Physics.h"
+#include "SaveLoadGame.h"
+#include "Soldier_Control.h"
+#include "Strategic_Turns.h"
+#include "Timer.h"
+#include "Timer_Control.h"
+
+#include <string_theory/format>
+
+#include <stdexcept>
+
+
+bool gfBattleSimulation = false;
+
+// Game time that passes per simulated game loop
+static UINT32 const BATTLE_LOOP_TIME = 10;
+// Give up on battles that take longer than an hour of game time
+static UINT32 const MAX_BATTLE_LOOPS = 60 * 60 * 1000 / BATTLE_LOOP_TIME;
+
+static char const* const g_team_names[] = { "Player", "Enemy", "Creature", "Militia", "Civilian" };
+static char const* const g_phase_names[] = { "Overhead", "AI", "Pathfinding", "World", "Events" };
+
+struct PhaseTime
+{
+	std::chrono::steady_clock::duration time;
+	UINT32                              calls;
+};
+
+static PhaseTime g_phase_times[NUM_BATTLE_PHASES];
+
+
+void AddBattlePhaseTime(BattlePhase const phase, std::chrono::steady_clock::duration const time)
+{
+	g_phase_times[phase].time += time;
+	++g_phase_times[phase].calls;
+}
+
+
+// Fighters of one team in the sector: still standing, down and in total
+struct TeamStatus
+{
+	UINT8 standing;
+	UINT8 down;
+	UINT8 total;
+};
+
+
+static TeamStatus GetTeamStatus(UINT8 const team)
+{
+	TeamStatus status{};
+	CFOR_EACH_IN_TEAM(s, team)
+	{
+		if (!s->bInSector) continue;
+		++status.total;
+		if (s->bLife >= OKLIFE)
+		{
+			++status.standing;
+		}
+		else
+		{
+			++status.down;
+		}
+	}
+	return status;
+}
+
+
+// The battle is over when at most one side has someone left standing
+static bool BattleIsOver()
+{
+	INT8 side = -1;
+	FOR_EACH_MERC(i)
+	{
+		SOLDIERTYPE const& s = **i;
+		if (!s.bInSector || s.bNeutral || s.bLife < OKLIFE) continue;
+		if (side == -1)
+		{
+			side = s.bSide;
+		}
+		else if (s.bSide != side)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+/* In turn-based combat the game waits for the player to act with the mercs.
+ * Give them to the AI one after the other instead, as for every other team,
+ * and end the turn once nobody can act any more. */
+static void TakePlayerTurn()
+{
+	TacticalStatusType const& ts = gTacticalStatus;
+	if (!(ts.uiFlags & INCOMBAT) || ts.ubCurrentTeam != OUR_TEAM) return;
+	if (ts.ubAttackBusyCount != 0 || ts.fEnemySightingOnTheirTurn) return;
+
+	CFOR_EACH_IN_TEAM(s, OUR_TEAM)
+	{
+		if (s->uiStatusFlags & SOLDIER_UNDERAICONTROL) return; // still acting
+	}
+
+	if (BuildAIListForTeam(OUR_TEAM))
+	{
+		if (SOLDIERTYPE* const s = RemoveFirstAIListEntry())
+		{
+			StartNPCAI(*s);
+			return;
+		}
+	}
+
+	if (!CheckForEndOfCombatMode(FALSE)) EndTurn(OUR_TEAM + 1);
+}
+
+
+// The parts of the tactical screen handler that do not render or wait for input
+static void SimulateGameLoop()
+{
+	guiFrozenClock += BATTLE_LOOP_TIME;
+	UpdateJA2Clock();
+
+	// The tactical screen shows who was spotted for a while, nobody is watching
+	TacticalStatusType& ts = gTacticalStatus;
+	if (ts.fEnemySightingOnTheirTurn)
+	{
+		SOLDIERTYPE* const s = ts.enemy_sighting_on_their_turn_enemy;
+		if (ts.ubCurrentTeam != OUR_TEAM) AdjustNoAPToFinishMove(s, FALSE);
+		s->fPauseAllAnimation = FALSE;
+		ts.fEnemySightingOnTheirTurn = FALSE;
+	}
+
+	{
+		BattlePhaseTimer const timer(BATTLE_PHASE_WORLD);
+		SimulateWorld();
+		UpdateBullets();
+	}
+
+	HandleStrategicTurn();
+
+	{
+		BattlePhaseTimer const timer(BATTLE_PHASE_OVERHEAD);
+		ExecuteOverhead();
+	}
+
+	TakePlayerTurn();
+
+	{
+		BattlePhaseTimer const timer(BATTLE_PHASE_EVENTS);
+		DequeAllGameEvents();
+		HandleDialogue();
+	}
+}
+
+
+void RunBattleSimulation(const ST::string& save_name)
+{
+	if (InitializeJA2() == ERROR_SCREEN)
+	{
+		throw std::runtime_error("failed to initialize the game");
+	}
+
+	LoadSavedGame(save_name);
+	if (guiScreenToGotoAfterLoadingSavedGame != GAME_SCREEN || !gfWorldLoaded)
+	{
+		throw std::runtime_error(ST::format("'{}' was not saved in tactical", save_name).to_std_string());
+	}
+
+	PauseTime(FALSE);
+	UnLockPauseState();
+	UnPauseGame();
+
+	gfBattleSimulation = true;
+	FOR_EACH_IN_TEAM(s, OUR_TEAM)
+	{
+		if (s->bInSector) s->uiStatusFlags |= SOLDIER_PCUNDERAICONTROL;
+	}
+
+	SLOGI("Simulating the battle of '{}'", save_name);
+	auto const start = std::chrono::steady_clock::now();
+
+	UINT32 loops        = 0;
+	UINT32 combat_loops = 0;
+	UINT32 turns        = 0;
+	UINT8  current_team = gTacticalStatus.ubCurrentTeam;
+	while (!BattleIsOver())
+	{
+		if (loops == MAX_BATTLE_LOOPS)
+		{
+			SLOGW("The battle did not end within {} minutes of game time", MAX_BATTLE_LOOPS * BATTLE_LOOP_TIME / 60000);
+			break;
+		}
+
+		SimulateGameLoop();
+		++loops;
+
+		if (gTacticalStatus.uiFlags & INCOMBAT)
+		{
+			++combat_loops;
+			if (current_team != OUR_TEAM && gTacticalStatus.ubCurrentTeam == OUR_TEAM) ++turns;
+		}
+		current_team = gTacticalStatus.ubCurrentTeam;
+	}
+
+	auto const elapsed = std::chrono::steady_clock::now() - start;
+	auto const ms = [](std::chrono::steady_clock::duration const d)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(d).count() / 1000.0;
+	};
+
+	SLOGI("Battle over after {} game loops ({} s of game time, {} in turn-based combat, {} turns) in {.1f} ms",
+		loops, loops * BATTLE_LOOP_TIME / 1000, combat_loops, turns, ms(elapsed));
+	for (UINT8 team = OUR_TEAM; team <= LAST_TEAM; ++team)
+	{
+		TeamStatus const status = GetTeamStatus(team);
+		if (status.total == 0) continue;
+		SLOGI("{} team: {} of {} standing, {} down", g_team_names[team], status.standing, status.total, status.down);
+	}
+	for (int phase = 0; phase != NUM_BATTLE_PHASES; ++phase)
+	{
+		PhaseTime const& p = g_phase_times[phase];
+		SLOGI("{} phase: {.1f} ms in {} calls", g_phase_names[phase], ms(p.time), p.calls);
+	}
+
+	gfBattleSimulation = false;
+}
@@ -0,0 +1,63 @@
+#ifndef BATTLE_SIMULATOR_H
+#define BATTLE_SIMULATOR_H
+
+#include <string_theory/string>
+
+#include <chrono>
+
+
+/* Headless battle runner for benchmarking the AI
+ *
+ * Loads a game that was saved in tactical, hands the mercs of the player to
+ * the AI and runs the tactical engine without rendering or UI until only one
+ * side is left standing. Game time is simulated, so a battle runs as fast as
+ * the AI and pathfinding allow and takes the same course on every run with
+ * the same seed. The seed is logged and can be given again with -seed.
+ * Timing and outcome are written to the log. */
+
+// Whether a battle simulation is running
+extern bool gfBattleSimulation;
+
+enum BattlePhase
+{
+	BATTLE_PHASE_OVERHEAD,    // soldier updates, includes AI and pathfinding
+	BATTLE_PHASE_AI,          // decisions of the AI
+	BATTLE_PHASE_PATHFINDING, // path searches, for the AI or not
+	BATTLE_PHASE_WORLD,       // physics and bullets
+	BATTLE_PHASE_EVENTS,      // game events and dialogue
+	NUM_BATTLE_PHASES
+};
+
+void AddBattlePhaseTime(BattlePhase, std::chrono::steady_clock::duration);
+
+// Adds the time until it goes out of scope to a phase, while simulating
+class BattlePhaseTimer
+{
+public:
+	explicit BattlePhaseTimer(BattlePhase const phase) :
+		m_phase(phase),
+		m_running(gfBattleSimulation)
+	{
+		if (m_running) m_start = std::chrono::steady_clock::now();
+	}
+
+	~BattlePhaseTimer()
+	{
+		if (m_running) AddBattlePhaseTime(m_phase, std::chrono::steady_clock::now() - m_start);
+	}
+
+	BattlePhaseTimer(BattlePhaseTimer const&) = delete;
+	BattlePhaseTimer& operator=(BattlePhaseTimer const&) = delete;
+
+private:
+	BattlePhase                           m_phase;
+	bool                                  m_running;
+	std::chrono::steady_clock::time_point m_start;
+};
+
+/* Loads the saved game and fights its battle to the end. Expects the game
+ * clock to be frozen, it is advanced by the simulation. Throws if the game
+ * cannot be loaded or was not saved in tactical. */
+void RunBattleSimulation(const ST::string& save_name);
+
+#endif
@@ -43,6 +43,7 @@
 #include "Random.h"
 #include "Render_Dirty.h"
 #include "RenderWorld.h"
+#include "ResourceCache.h"
 #include "ScreenIDs.h"
 #include "ShopKeeper_Interface.h"
 #include "SkillCheck.h"
@@ -57,7 +58,6 @@
 #include "WCheck.h"
 #include "WordWrap.h"
 #include "WorldMan.h"
-#include <map>
 #include <memory>
 #include <queue>
 #include <string_theory/format>
@@ -69,7 +69,13 @@
 
 using DialogueQueue = std::queue<std::unique_ptr<DialogueEvent>>;
 
-static std::map<ProfileID, FACETYPE*> externalNPCFaces;
+// Faces of NPCs who talk without being in the sector. They are loaded when
+// first needed and unloaded again when the budget is exceeded, unless they
+// are preloaded or have a quote queued or playing.
+#define EXTERNAL_NPC_FACES_BUDGET (512 * 1024)
+
+static ResourceCache<ProfileID, FACETYPE*> externalNPCFaces("External NPC faces", EXTERNAL_NPC_FACES_BUDGET,
+	[](ProfileID const&, FACETYPE*& face) { DeleteFace(face); });
 
 const ProfileID preloadedExternalNPCFaces[] = {
 	SKYRIDER,
@@ -173,29 +179,70 @@ void ShutdownDialogueControl()
 }
 
 
-void LoadExternalNPCFace(ProfileID mercID)
+// Rough number of bytes held by a face: its pixel data, palette and buffers
+static size_t FaceMemoryUsage(FACETYPE const& f)
 {
-	if (externalNPCFaces.find(mercID) == externalNPCFaces.end())
+	size_t bytes = sizeof(FACETYPE);
+	if (f.uiVideoObject)
 	{
-		externalNPCFaces[mercID] = &InitFace(mercID, nullptr, FACE_FORCE_SMALL);
+		SGPVObject const& vo = *f.uiVideoObject;
+		for (UINT16 i = 0; i != vo.SubregionCount(); ++i)
+		{
+			bytes += vo.SubregionProperties(i).uiDataLength;
+		}
+		bytes += 256 * sizeof(UINT16);
 	}
+	size_t const buffer = f.usFaceWidth * f.usFaceHeight * sizeof(UINT16);
+	if (f.fAutoRestoreBuffer) bytes += buffer;
+	if (f.fAutoDisplayBuffer) bytes += buffer;
+	return bytes;
+}
+
+
+void LoadExternalNPCFace(ProfileID mercID)
+{
+	if (externalNPCFaces.peek(mercID)) return;
+
+	FACETYPE& f = InitFace(mercID, nullptr, FACE_FORCE_SMALL);
+	externalNPCFaces.insert(mercID, &f, FaceMemoryUsage(f));
 }
 
 FACETYPE* GetExternalNPCFace(ProfileID mercID)
 {
-	LoadExternalNPCFace(mercID); // ensure we have loaded the face
-	return externalNPCFaces.at(mercID);
+	if (FACETYPE** const face = externalNPCFaces.find(mercID)) return *face;
+
+	LoadExternalNPCFace(mercID);
+	return *externalNPCFaces.peek(mercID);
+}
+
+// Keep an external NPC face loaded while a quote refers to it, a no-op for other faces
+static void PinExternalNPCFace(ProfileID const id, FACETYPE const* const face, bool const pin)
+{
+	if (!face) return;
+
+	FACETYPE** const cached = externalNPCFaces.peek(id);
+	if (!cached || *cached != face) return;
+
+	if (pin)
+	{
+		externalNPCFaces.pin(id);
+	}
+	else
+	{
+		externalNPCFaces.unpin(id);
+	}
 }
 
 void PreloadExternalNPCFaces()
 {
 	// go and grab all external NPC faces that are needed for the game who won't exist as soldiertypes
 
-	if (!externalNPCFaces.empty()) return;
+	if (externalNPCFaces.size() != 0) return;
 
 	for (size_t i = 0; i < lengthof(preloadedExternalNPCFaces); i++)
 	{
 		LoadExternalNPCFace(preloadedExternalNPCFaces[i]);
+		externalNPCFaces.pin(preloadedExternalNPCFaces[i]);
 	}
 }
 
@@ -203,11 +250,6 @@ void PreloadExternalNPCFaces()
 void UnloadExternalNPCFaces()
 {
 	// Remove all external NPC faces.
-	for (auto const& entry : externalNPCFaces)
-	{
-		DeleteFace(entry.second);
-	}
-
 	externalNPCFaces.clear();
 }
 
@@ -418,6 +460,7 @@ void HandleDialogue()
 			f.uiFlags &= ~FACE_TRIGGER_PREBATTLE_INT;
 		}
 
+		PinExternalNPCFace(gubCurrentTalkingID, gpCurrentTalkingFace, false);
 		gpCurrentTalkingFace = NULL;
 		gubCurrentTalkingID = NO_PROFILE;
 		gTacticalStatus.ubLastQuoteProfileNUm = NO_PROFILE;
@@ -621,7 +664,14 @@ void CharacterDialogue(UINT8 const character, UINT16 const quote, FACETYPE* cons
 				face(face_),
 				from_soldier_(from_soldier),
 				delayed_(delayed)
-			{}
+			{
+				PinExternalNPCFace(character_, face, true);
+			}
+
+			~DialogueEventQuote()
+			{
+				PinExternalNPCFace(character_, face, false);
+			}
 
 			bool Execute()
 			{
@@ -718,6 +768,11 @@ static BOOLEAN GetDialogue(const MercProfile &profile, UINT16 usQuoteNum, ST::st
 // execute specific character dialogue
 BOOLEAN ExecuteCharacterDialogue(UINT8 const ubCharacterNum, UINT16 const usQuoteNum, FACETYPE* const face, DialogueHandler const bUIHandlerID, BOOLEAN const fFromSoldier, bool useAlternateDialogueFile)
 {
+	if (gpCurrentTalkingFace != face)
+	{
+		PinExternalNPCFace(gubCurrentTalkingID, gpCurrentTalkingFace, false);
+		PinExternalNPCFace(ubCharacterNum, face, true);
+	}
 	gpCurrentTalkingFace = face;
 	gubCurrentTalkingID  = ubCharacterNum;
 
@@ -784,6 +784,63 @@ void RenderInvBodyPanel(const SOLDIERTYPE* pSoldier, INT16 sX, INT16 sY)
 }
 
 
+// What an inventory slot of the single merc panel shows in the save buffer, so
+// a redraw of the panel only has to paint the slots that changed since.
+struct InvSlotRender
+{
+	UINT16 usItem;
+	UINT8  ubNumberOfObjects;
+	INT8   bStatus[MAX_OBJECTS_PER_SLOT]; // also holds the ammo and money amount
+	UINT16 usAttachItem[MAX_ATTACHMENTS];
+	INT8   bAttachStatus[MAX_ATTACHMENTS];
+	UINT8  ubImprintID;
+	INT8   weapon_mode;
+	bool   outlined;
+	bool   new_item;
+};
+
+static InvSlotRender      gInvSlotRender[NUM_INV_SLOTS];
+static SOLDIERTYPE const* gInvSlotRenderMerc; // NULL if the slots are unknown
+
+
+void InvalidateInvSlotRenders()
+{
+	gInvSlotRenderMerc = NULL;
+}
+
+
+static InvSlotRender GetInvSlotRender(SOLDIERTYPE const& s, INT16 const pocket)
+{
+	OBJECTTYPE const& o = s.inv[pocket];
+	InvSlotRender r{};
+	r.usItem            = o.usItem;
+	r.ubNumberOfObjects = o.ubNumberOfObjects;
+	std::copy(std::begin(o.bStatus),       std::end(o.bStatus),       std::begin(r.bStatus));
+	std::copy(std::begin(o.usAttachItem),  std::end(o.usAttachItem),  std::begin(r.usAttachItem));
+	std::copy(std::begin(o.bAttachStatus), std::end(o.bAttachStatus), std::begin(r.bAttachStatus));
+	r.ubImprintID       = o.ubImprintID;
+	if (pocket == HANDPOS) r.weapon_mode = s.bWeaponMode;
+	r.outlined = gbCompatibleAmmo[pocket];
+	r.new_item = s.bNewItemCount[pocket] > 0;
+	return r;
+}
+
+
+static bool operator==(InvSlotRender const& a, InvSlotRender const& b)
+{
+	return
+		a.usItem            == b.usItem            &&
+		a.ubNumberOfObjects == b.ubNumberOfObjects &&
+		std::equal(std::begin(a.bStatus),       std::end(a.bStatus),       std::begin(b.bStatus))       &&
+		std::equal(std::begin(a.usAttachItem),  std::end(a.usAttachItem),  std::begin(b.usAttachItem))  &&
+		std::equal(std::begin(a.bAttachStatus), std::end(a.bAttachStatus), std::begin(b.bAttachStatus)) &&
+		a.ubImprintID       == b.ubImprintID       &&
+		a.weapon_mode       == b.weapon_mode       &&
+		a.outlined          == b.outlined          &&
+		a.new_item          == b.new_item;
+}
+
+
 static void INVRenderINVPanelItem(SOLDIERTYPE const& s, INT16 const pocket, DirtyLevel const dirty_level)
 {
 	guiCurrentItemDescriptionScreen = guiCurrentScreen;
@@ -863,13 +920,54 @@ static void INVRenderINVPanelItem(SOLDIERTYPE const& s, INT16 const pocket, Dirt
 }
 
 
-void HandleRenderInvSlots(SOLDIERTYPE const& s, DirtyLevel const dirty_level)
+void HandleRenderInvSlots(SOLDIERTYPE const& s, DirtyLevel const dirty_level, SGPVSurface* const background)
 {
 	if (InItemDescriptionBox() || InItemStackPopup() || InKeyRingPopup()) return;
 
-	for (INT32 i = 0; i != NUM_INV_SLOTS; ++i)
+	if (dirty_level == DIRTYLEVEL2 && background && gInvSlotRenderMerc == &s)
 	{
-		INVRenderINVPanelItem(s, i, dirty_level);
+		// Only repaint the slots that look different, on top of the bare panel
+		for (INT32 i = 0; i != NUM_INV_SLOTS; ++i)
+		{
+			InvSlotRender const render = GetInvSlotRender(s, i);
+			if (render == gInvSlotRender[i])
+			{
+				INVRenderINVPanelItem(s, i, DIRTYLEVEL1);
+				continue;
+			}
+
+			// Include the status bar left of the slot
+			MOUSE_REGION const& r = gSMInvRegion[i];
+			INT16 const x = r.X() - INV_BAR_DX;
+			INT16 const y = r.Y();
+			INT16 const w = r.W() + INV_BAR_DX;
+			INT16 const h = r.H();
+			SGPBox const box = { (UINT16)(x - INTERFACE_START_X), (UINT16)(y - INV_INTERFACE_START_Y), (UINT16)w, (UINT16)h };
+			BltVideoSurface(guiSAVEBUFFER, background, x, y, &box);
+			INVRenderINVPanelItem(s, i, DIRTYLEVEL2);
+			RestoreExternBackgroundRect(x, y, w, h);
+			gInvSlotRender[i] = render;
+		}
+	}
+	else
+	{
+		for (INT32 i = 0; i != NUM_INV_SLOTS; ++i)
+		{
+			INVRenderINVPanelItem(s, i, dirty_level);
+		}
+
+		if (dirty_level == DIRTYLEVEL2 && background)
+		{
+			for (INT32 i = 0; i != NUM_INV_SLOTS; ++i)
+			{
+				gInvSlotRender[i] = GetInvSlotRender(s, i);
+			}
+			gInvSlotRenderMerc = &s;
+		}
+		else if (!background)
+		{
+			gInvSlotRenderMerc = NULL;
+		}
 	}
 
 	if (KeyExistsInKeyRing(s, ANYKEY))
@@ -39,7 +39,12 @@ BOOLEAN HandleItemPickupMenu(void);
 // FUNCTIONS FOR INTERFACEING WITH ITEM PANEL STUFF
 void InitInvSlotInterface(INV_REGION_DESC const* pRegionDesc, INV_REGION_DESC const* pCamoRegion, MOUSE_CALLBACK INVMoveCallback, MOUSE_CALLBACK INVClickCallback, MOUSE_CALLBACK INVMoveCamoCallback, MOUSE_CALLBACK INVClickCamoCallback);
 void ShutdownInvSlotInterface();
-void HandleRenderInvSlots(SOLDIERTYPE const&, DirtyLevel);
+/* Render the inventory slots. The background, if given, is the single merc
+ * panel as it looks below the items. It allows a redraw with DIRTYLEVEL2 to
+ * only repaint the slots that changed since the last full redraw. */
+void HandleRenderInvSlots(SOLDIERTYPE const&, DirtyLevel, SGPVSurface* background = NULL);
+// Forget what the slots show, the next redraw with DIRTYLEVEL2 repaints all of them
+void InvalidateInvSlotRenders();
 void HandleNewlyAddedItems(SOLDIERTYPE&, DirtyLevel*);
 void RenderInvBodyPanel(const SOLDIERTYPE* pSoldier, INT16 sX, INT16 sY);
 void DisableInvRegions( BOOLEAN fDisable );
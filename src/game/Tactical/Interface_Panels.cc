@@ -72,6 +72,7 @@
 #include "Video.h"
 #include "WeaponModels.h"
 #include "Weapons.h"
+#include "Sys_Globals.h"
 #include "WordWrap.h"
 
 #include <algorithm>
@@ -308,6 +309,8 @@ GUIButtonRef iTEAMPanelButtons[NUM_TEAM_BUTTONS];
 
 // Video Surface for Single Merc Panel
 static SGPVSurface* guiSMPanel;
+// The panel as it looks below the inventory items, for repainting single slots
+static SGPVSurface* guiSMPanelBackground;
 static SGPVObject* guiSMObjects;
 static SGPVObject* guiSMObjects2;
 
@@ -333,6 +336,55 @@ SOLDIERTYPE *gpSMCurrentMerc = NULL;
 MOUSE_REGION gSMPanelRegion;
 
 
+/* The panels are drawn into the save buffer and only copied to the frame buffer
+ * for most redraws. What a panel widget shows there is remembered, so a redraw
+ * only has to paint the widgets that changed. That only holds while nothing
+ * else draws over the panel, which IsPanelRenderKept() checks for. */
+static bool IsPanelRenderKept(unsigned& last_cycle)
+{
+	// Any other screen, or a frame without the panel, may have used the buffer
+	bool const kept = guiCurrentScreen == GAME_SCREEN && guiGameCycleCounter - last_cycle <= 1;
+	last_cycle = guiGameCycleCounter;
+	return kept;
+}
+
+
+// Everything the single merc panel shows besides the face and the inventory slots
+struct SMPanelRender
+{
+	SOLDIERTYPE const* merc;
+	SGPVObject const*  plate;
+	bool               two_handed;
+	bool               stealth;
+	bool               ok_life;
+	UINT8              stat_colour[10];
+	INT8               stat[10];
+	INT32              stat_progress[10];
+	INT32              armour;
+	UINT32             weight;
+	INT8               camo;
+};
+
+static SMPanelRender gSMPanelRender;
+static bool          gfSMPanelRendered = false;
+static unsigned      guiSMPanelRenderCycle;
+
+
+// What the face, border, name and hands of a team panel slot show
+struct TeamSlotRender
+{
+	SOLDIERTYPE const* merc;
+	INT16              border;
+	UINT32             flags;
+	bool               stealth;
+	INT8               weapon_mode;
+	UINT16             hand_item[2]; // only the item graphic is kept in the save buffer
+};
+
+static bool     gfTEAMPanelRendered = false;
+static unsigned guiTEAMPanelRenderCycle;
+
+
 struct TeamPanelSlot
 {
 	SOLDIERTYPE* merc;
@@ -342,6 +394,7 @@ struct TeamPanelSlot
 	MOUSE_REGION left_bars;
 	MOUSE_REGION first_hand;
 	MOUSE_REGION second_hand;
+	TeamSlotRender rendered;
 };
 
 static std::vector<TeamPanelSlot> gTeamPanel;
@@ -897,6 +950,9 @@ void InitializeSMPanel()
 		DrawFillerOnSurface(guiSMPanel, dest);
 	}
 
+	guiSMPanelBackground = new SGPVSurface(g_ui.m_teamPanelWidth, INV_INTERFACE_HEIGHT, PIXEL_DEPTH);
+	gfSMPanelRendered    = false;
+
 	guiSMObjects  = AddVideoObjectFromFile(INTERFACEDIR "/inventory_gold_front.sti");
 	guiSMObjects2 = AddVideoObjectFromFile(INTERFACEDIR "/inv_frn.sti");
 
@@ -1097,6 +1153,8 @@ void ShutdownSMPanel()
 	// All buttons and regions and video objects and video surfaces will be deleted at shutddown of SGM
 	// We may want to delete them at the interm as well, to free up room for other panels
 	delete guiSMPanel;
+	delete guiSMPanelBackground;
+	gfSMPanelRendered = false;
 	DeleteVideoObject(guiSMObjects);
 	DeleteVideoObject(guiSMObjects2);
 
@@ -1200,33 +1258,142 @@ void ProgressBarBackgroundRect(const INT16 sLeft, const INT16 sTop, const INT16
 	}
 }
 
-static void PrintStat(UINT32 const change_time, UINT16 const stat_bit, INT8 const stat_val, INT16 const x, INT16 const y, INT32 const progress)
+struct SMPanelStat
 {
-	SOLDIERTYPE const& s  = *gpSMCurrentMerc;
+	UINT32 change_time;
+	UINT16 stat_bit;
+	INT8   value;
+	INT16  x;
+	INT16  y;
+	INT32  progress;
+};
+
 
-	UINT8       const  fg =
-		s.bLife < OKLIFE                                             ? FONT_MCOLOR_DKGRAY    :
-		GetJA2Clock() >= CHANGE_STAT_RECENTLY_DURATION + change_time ? STATS_TEXT_FONT_COLOR :
-		change_time == 0                                             ? STATS_TEXT_FONT_COLOR :
-		s.usValueGoneUp & stat_bit                                   ? FONT_LTGREEN          :
+static void GetSMPanelStats(SOLDIERTYPE const& s, SMPanelStat (&stats)[10])
+{
+	INT32 const dx = INTERFACE_START_X;
+	INT32 const dy = INV_INTERFACE_START_Y;
+	MERCPROFILESTRUCT const& p = GetProfile(s.ubProfile);
+	stats[0] = { s.uiChangeAgilityTime,      AGIL_INCREASE,     s.bAgility,      (INT16)(dx + SM_AGI_X),    (INT16)(dy + SM_AGI_Y),    p.sAgilityGain*2 };
+	stats[1] = { s.uiChangeDexterityTime,    DEX_INCREASE,      s.bDexterity,    (INT16)(dx + SM_DEX_X),    (INT16)(dy + SM_DEX_Y),    p.sDexterityGain*2 };
+	stats[2] = { s.uiChangeStrengthTime,     STRENGTH_INCREASE, s.bStrength,     (INT16)(dx + SM_STR_X),    (INT16)(dy + SM_STR_Y),    p.sStrengthGain*2 };
+	stats[3] = { s.uiChangeLeadershipTime,   LDR_INCREASE,      s.bLeadership,   (INT16)(dx + SM_CHAR_X),   (INT16)(dy + SM_CHAR_Y),   p.sLeadershipGain*2 };
+	stats[4] = { s.uiChangeWisdomTime,       WIS_INCREASE,      s.bWisdom,       (INT16)(dx + SM_WIS_X),    (INT16)(dy + SM_WIS_Y),    p.sWisdomGain*2 };
+	stats[5] = { s.uiChangeLevelTime,        LVL_INCREASE,      s.bExpLevel,     (INT16)(dx + SM_EXPLVL_X), (INT16)(dy + SM_EXPLVL_Y), p.sExpLevelGain*100/(350*p.bExpLevel) };
+	stats[6] = { s.uiChangeMarksmanshipTime, MRK_INCREASE,      s.bMarksmanship, (INT16)(dx + SM_MRKM_X),   (INT16)(dy + SM_MRKM_Y),   p.sMarksmanshipGain*4 };
+	stats[7] = { s.uiChangeExplosivesTime,   EXP_INCREASE,      s.bExplosive,    (INT16)(dx + SM_EXPL_X),   (INT16)(dy + SM_EXPL_Y),   p.sExplosivesGain*4 };
+	stats[8] = { s.uiChangeMechanicalTime,   MECH_INCREASE,     s.bMechanical,   (INT16)(dx + SM_MECH_X),   (INT16)(dy + SM_MECH_Y),   p.sMechanicGain*4 };
+	stats[9] = { s.uiChangeMedicalTime,      MED_INCREASE,      s.bMedical,      (INT16)(dx + SM_MED_X),    (INT16)(dy + SM_MED_Y),    p.sMedicalGain*4 };
+}
+
+
+static UINT8 GetStatColour(SOLDIERTYPE const& s, SMPanelStat const& stat)
+{
+	return
+		s.bLife < OKLIFE                                                  ? FONT_MCOLOR_DKGRAY    :
+		GetJA2Clock() >= CHANGE_STAT_RECENTLY_DURATION + stat.change_time ? STATS_TEXT_FONT_COLOR :
+		stat.change_time == 0                                             ? STATS_TEXT_FONT_COLOR :
+		s.usValueGoneUp & stat.stat_bit                                   ? FONT_LTGREEN          :
 		FONT_RED;
+}
+
 
-	SetFontForeground(fg);
+static void PrintStat(SOLDIERTYPE const& s, SMPanelStat const& stat)
+{
+	SetFontForeground(GetStatColour(s, stat));
 
-	ST::string str = ST::format("{3d}", stat_val);
+	ST::string str = ST::format("{3d}", stat.value);
 	if (gamepolicy(gui_extras))
 	{
-		ProgressBarBackgroundRect(x + 16, y - 2, 15 * progress / 100, 10, 0x514A05, progress);
+		ProgressBarBackgroundRect(stat.x + 16, stat.y - 2, 15 * stat.progress / 100, 10, 0x514A05, stat.progress);
 	}
 
-	DrawStringRight(str, x, y, SM_STATS_WIDTH, SM_STATS_HEIGHT, BLOCKFONT2);
+	DrawStringRight(str, stat.x, stat.y, SM_STATS_WIDTH, SM_STATS_HEIGHT, BLOCKFONT2);
+}
+
+
+static SGPVObject const* GetSMPanelPlate(SOLDIERTYPE const& s)
+{
+	if (gfSMDisableForItems) return guiSMObjects2;
+	if (gTacticalStatus.ubCurrentTeam == OUR_TEAM &&
+		&s == GetSelectedMan() &&
+		OK_INTERRUPT_MERC(&s))
+	{
+		return guiSMObjects;
+	}
+	return NULL;
 }
 
+
+static SMPanelRender GetSMPanelRender(SOLDIERTYPE const& s)
+{
+	SMPanelRender r{};
+	r.merc       = &s;
+	r.plate      = GetSMPanelPlate(s);
+	r.two_handed = GCM->getItem(s.inv[HANDPOS].usItem)->isTwoHanded();
+	r.stealth    = s.bStealthMode;
+	r.ok_life    = s.bLife >= OKLIFE;
+
+	SMPanelStat stats[10];
+	GetSMPanelStats(s, stats);
+	for (UINT32 i = 0; i != lengthof(stats); ++i)
+	{
+		r.stat_colour[i]   = GetStatColour(s, stats[i]);
+		r.stat[i]          = stats[i].value;
+		r.stat_progress[i] = stats[i].progress;
+	}
+
+	r.armour = ArmourPercent(&s);
+	r.weight = CalculateCarriedWeight(&s);
+	r.camo   = s.bCamo;
+	return r;
+}
+
+
+static bool operator==(SMPanelRender const& a, SMPanelRender const& b)
+{
+	return
+		a.merc       == b.merc       &&
+		a.plate      == b.plate      &&
+		a.two_handed == b.two_handed &&
+		a.stealth    == b.stealth    &&
+		a.ok_life    == b.ok_life    &&
+		std::equal(std::begin(a.stat_colour),   std::end(a.stat_colour),   std::begin(b.stat_colour))   &&
+		std::equal(std::begin(a.stat),          std::end(a.stat),          std::begin(b.stat))          &&
+		std::equal(std::begin(a.stat_progress), std::end(a.stat_progress), std::begin(b.stat_progress)) &&
+		a.armour     == b.armour     &&
+		a.weight     == b.weight     &&
+		a.camo       == b.camo;
+}
+
+
+// The name is printed to the frame buffer, so it is needed on every full redraw
+static void RenderSMPanelName(SOLDIERTYPE const& s)
+{
+	UINT8 const fg = s.bStealthMode ? FONT_MCOLOR_LTYELLOW : FONT_MCOLOR_LTGRAY;
+	SetFontAttributes(BLOCKFONT2, fg);
+
+	INT16 const x = SM_SELMERCNAME_X + INTERFACE_START_X;
+	INT16 const y = SM_SELMERCNAME_Y + INV_INTERFACE_START_Y;
+	INT16 const w = SM_SELMERCNAME_WIDTH;
+	INT16 const h = SM_SELMERCNAME_HEIGHT;
+	RestoreExternBackgroundRect(x, y, w, h);
+	INT16 sFontX;
+	INT16 sFontY;
+	FindFontCenterCoordinates(x, y, w, h, s.name, BLOCKFONT2, &sFontX, &sFontY);
+	MPrint(sFontX, sFontY, s.name);
+}
+
+
 void RenderSMPanel(DirtyLevel* const dirty_level)
 {
 	// Give him the panel
 	if (gSelectSMPanelToMerc) SetSMPanelCurrentMerc(gSelectSMPanelToMerc);
 
+	// Popups and the description box draw over the panel in the save buffer
+	bool const covered = InItemDescriptionBox() || InItemStackPopup() || InKeyRingPopup() || gfSMDisableForItems;
+	if (!IsPanelRenderKept(guiSMPanelRenderCycle) || covered) gfSMPanelRendered = false;
+
 	// ATE: Don't do anything if we are in stack popup and are refreshing stuff
 	if ((InItemStackPopup() || InKeyRingPopup()) && *dirty_level == DIRTYLEVEL1)
 		return;
@@ -1252,32 +1419,29 @@ void RenderSMPanel(DirtyLevel* const dirty_level)
 	INT32 const dx = INTERFACE_START_X;
 	INT32 const dy = INV_INTERFACE_START_Y;
 
-	if (*dirty_level == DIRTYLEVEL2)
+	// The bare panel below the inventory slots, if only they may need a repaint
+	SGPVSurface* slot_background = NULL;
+
+	SMPanelRender const panel_render = *dirty_level == DIRTYLEVEL2 ? GetSMPanelRender(s) : SMPanelRender{};
+	if (*dirty_level == DIRTYLEVEL2 && gfSMPanelRendered && panel_render == gSMPanelRender)
+	{
+		// Plate and stats are still in the save buffer
+		RenderSoldierFace(s, dx + SM_SELMERC_FACE_X, dy + SM_SELMERC_FACE_Y);
+		RestoreExternBackgroundRect(0, INV_INTERFACE_START_Y, SCREEN_WIDTH, SCREEN_HEIGHT - INV_INTERFACE_START_Y);
+		RenderSMPanelName(s);
+		slot_background = guiSMPanelBackground;
+	}
+	else if (*dirty_level == DIRTYLEVEL2)
 	{
 		BltVideoSurface(guiSAVEBUFFER, guiSMPanel, dx, dy, NULL);
 
+		if (SGPVObject const* const gfx = panel_render.plate)
 		{
-			SGPVObject const* gfx;
-			if (gfSMDisableForItems)
-			{
-				gfx = guiSMObjects2;
-			}
-			else if (gTacticalStatus.ubCurrentTeam == OUR_TEAM &&
-				&s == GetSelectedMan() &&
-				OK_INTERRUPT_MERC(&s))
-			{
-				gfx = guiSMObjects;
-			}
-			else
-			{
-				goto no_plate;
-			}
 			INT32 const x = SM_SELMERC_PLATE_X + dx;
 			INT32 const y = SM_SELMERC_PLATE_Y + dy;
 			BltVideoObject(guiSAVEBUFFER, gfx, 0, x, y);
 			RestoreExternBackgroundRect(x, y, SM_SELMERC_PLATE_WIDTH, SM_SELMERC_PLATE_HEIGHT);
 		}
-no_plate:
 
 		RenderSoldierFace(s, dx + SM_SELMERC_FACE_X, dy + SM_SELMERC_FACE_Y);
 
@@ -1289,6 +1453,12 @@ no_plate:
 		{
 			RenderInvBodyPanel(&s, SM_BODYINV_X, SM_BODYINV_Y);
 
+			// Keep the panel as it is below the items for repainting single slots
+			SGPBox const panel_box = { (UINT16)dx, (UINT16)dy, (UINT16)g_ui.m_teamPanelWidth, INV_INTERFACE_HEIGHT };
+			BltVideoSurface(guiSMPanelBackground, guiSAVEBUFFER, 0, 0, &panel_box);
+			slot_background = guiSMPanelBackground;
+			InvalidateInvSlotRenders();
+
 			// Render Values for stats
 			SetFontDestBuffer(guiSAVEBUFFER);
 			SetFontAttributes(BLOCKFONT2, STATS_TITLE_FONT_COLOR);
@@ -1308,17 +1478,12 @@ no_plate:
 			MPrint(dx + SM_CAMO_LABEL_X - StringPixLength(pInvPanelTitleStrings[2], BLOCKFONT2), dy + SM_CAMO_LABEL_Y, pInvPanelTitleStrings[2]);
 			MPrint(dx + SM_CAMO_PERCENT_X, dy + SM_CAMO_PERCENT_Y, "%");
 
-			MERCPROFILESTRUCT& p = GetProfile(s.ubProfile);
-			PrintStat(s.uiChangeAgilityTime,      AGIL_INCREASE,     s.bAgility,      dx + SM_AGI_X,    dy + SM_AGI_Y,    p.sAgilityGain*2);
-			PrintStat(s.uiChangeDexterityTime,    DEX_INCREASE,      s.bDexterity,    dx + SM_DEX_X,    dy + SM_DEX_Y,    p.sDexterityGain*2);
-			PrintStat(s.uiChangeStrengthTime,     STRENGTH_INCREASE, s.bStrength,     dx + SM_STR_X,    dy + SM_STR_Y,    p.sStrengthGain*2);
-			PrintStat(s.uiChangeLeadershipTime,   LDR_INCREASE,      s.bLeadership,   dx + SM_CHAR_X,   dy + SM_CHAR_Y,   p.sLeadershipGain*2);
-			PrintStat(s.uiChangeWisdomTime,       WIS_INCREASE,      s.bWisdom,       dx + SM_WIS_X,    dy + SM_WIS_Y,    p.sWisdomGain*2);
-			PrintStat(s.uiChangeLevelTime,        LVL_INCREASE,      s.bExpLevel,     dx + SM_EXPLVL_X, dy + SM_EXPLVL_Y, p.sExpLevelGain*100/(350*p.bExpLevel));
-			PrintStat(s.uiChangeMarksmanshipTime, MRK_INCREASE,      s.bMarksmanship, dx + SM_MRKM_X,   dy + SM_MRKM_Y,   p.sMarksmanshipGain*4);
-			PrintStat(s.uiChangeExplosivesTime,   EXP_INCREASE,      s.bExplosive,    dx + SM_EXPL_X,   dy + SM_EXPL_Y,   p.sExplosivesGain*4);
-			PrintStat(s.uiChangeMechanicalTime,   MECH_INCREASE,     s.bMechanical,   dx + SM_MECH_X,   dy + SM_MECH_Y,   p.sMechanicGain*4);
-			PrintStat(s.uiChangeMedicalTime,      MED_INCREASE,      s.bMedical,      dx + SM_MED_X,    dy + SM_MED_Y,    p.sMedicalGain*4);
+			SMPanelStat stats[10];
+			GetSMPanelStats(s, stats);
+			for (SMPanelStat const& stat : stats)
+			{
+				PrintStat(s, stat);
+			}
 
 			SetFontForeground(s.bLife >= OKLIFE ? STATS_TEXT_FONT_COLOR : FONT_MCOLOR_DKGRAY);
 
@@ -1327,17 +1492,17 @@ no_plate:
 			ST::string sString;
 
 			// Display armour value
-			sString = ST::format("{3d}", ArmourPercent(&s));
+			sString = ST::format("{3d}", panel_render.armour);
 			FindFontRightCoordinates(dx + SM_ARMOR_X, dy + SM_ARMOR_Y, SM_PERCENT_WIDTH, SM_PERCENT_HEIGHT, sString, BLOCKFONT2, &usX, &usY);
 			MPrint(usX, usY , sString);
 
 			// Display weight value
-			sString = ST::format("{3d}", CalculateCarriedWeight(&s));
+			sString = ST::format("{3d}", panel_render.weight);
 			FindFontRightCoordinates(dx + SM_WEIGHT_X, dy + SM_WEIGHT_Y, SM_PERCENT_WIDTH, SM_PERCENT_HEIGHT, sString, BLOCKFONT2, &usX, &usY);
 			MPrint(usX, usY, sString);
 
 			// Display camo value
-			sString = ST::format("{3d}", s.bCamo);
+			sString = ST::format("{3d}", panel_render.camo);
 			FindFontRightCoordinates(dx + SM_CAMO_X, dy + SM_CAMO_Y, SM_PERCENT_WIDTH, SM_PERCENT_HEIGHT, sString, BLOCKFONT2, &usX, &usY);
 			MPrint(usX, usY, sString);
 
@@ -1346,19 +1511,14 @@ no_plate:
 			RestoreExternBackgroundRect(0, INV_INTERFACE_START_Y, SCREEN_WIDTH, SCREEN_HEIGHT - INV_INTERFACE_START_Y);
 		}
 
-		// Render name
-		UINT8 const fg = s.bStealthMode ? FONT_MCOLOR_LTYELLOW : FONT_MCOLOR_LTGRAY;
-		SetFontAttributes(BLOCKFONT2, fg);
+		RenderSMPanelName(s);
 
-		INT16 const x = SM_SELMERCNAME_X + dx;
-		INT16 const y = SM_SELMERCNAME_Y + dy;
-		INT16 const w = SM_SELMERCNAME_WIDTH;
-		INT16 const h = SM_SELMERCNAME_HEIGHT;
-		RestoreExternBackgroundRect(x, y, w, h);
-		INT16 sFontX;
-		INT16 sFontY;
-		FindFontCenterCoordinates(x, y, w, h, s.name, BLOCKFONT2, &sFontX, &sFontY);
-		MPrint(sFontX, sFontY, s.name);
+		gSMPanelRender    = panel_render;
+		gfSMPanelRendered = slot_background != NULL && !covered;
+	}
+	else if (gfSMPanelRendered)
+	{
+		slot_background = guiSMPanelBackground;
 	}
 
 	if (*dirty_level != DIRTYLEVEL0)
@@ -1376,7 +1536,7 @@ no_plate:
 	UpdateSMPanel();
 
 	// Render items in guy's hand
-	HandleRenderInvSlots(s, *dirty_level);
+	HandleRenderInvSlots(s, *dirty_level, slot_background);
 
 	if (gfSMDisableForItems && *dirty_level != DIRTYLEVEL0)
 	{
@@ -2257,6 +2417,7 @@ void InitializeTEAMPanel()
 
 	// Create the TEAMpanel from graphic objects.
 	guiTEAMPanel = new SGPVSurface(g_ui.m_teamPanelWidth, TEAMPANEL_HEIGHT, PIXEL_DEPTH);
+	gfTEAMPanelRendered = false;
 
 	auto vsTEAMPanel = CreateVideoSurfaceFromObjectFile(INTERFACEDIR "/bottom_bar.sti", 0);
 	BltVideoSurface(guiTEAMPanel, vsTEAMPanel.get(), 0, 0, NULL);
@@ -2346,110 +2507,201 @@ void ShutdownTEAMPanel()
 }
 
 
+// The frame around a team panel slot, -1 for none
+static INT16 GetTeamSlotBorder(const SOLDIERTYPE* const s)
+{
+	if      (gTacticalStatus.ubCurrentTeam != OUR_TEAM) return 1; // Hatch out
+	else if (INTERRUPT_QUEUED && (!s || s->bMoved))     return 1; // Hatch out
+	else if (s && s == GetSelectedMan())                return 0; // Active border
+	else                                                return -1;
+}
+
+
 static void RenderTeamSlotBorder(const SOLDIERTYPE* const s, const INT32 dx, const INT32 dy)
 {
-	UINT16 region;
-	if      (gTacticalStatus.ubCurrentTeam != OUR_TEAM) region = 1; // Hatch out
-	else if (INTERRUPT_QUEUED && (!s || s->bMoved))     region = 1; // Hatch out
-	else if (s && s == GetSelectedMan())                region = 0; // Active border
-	else                                                return;
+	INT16 const region = GetTeamSlotBorder(s);
+	if (region < 0) return;
 	const INT32 x = dx + TM_FACEHIGHTL_X;
 	const INT32 y = dy + TM_FACEHIGHTL_Y;
 	BltVideoObject(guiSAVEBUFFER, guiTEAMObjects, region, x, y);
 }
 
 
+static TeamSlotRender GetTeamSlotRender(SOLDIERTYPE const* const s)
+{
+	TeamSlotRender r{};
+	r.merc   = s;
+	r.border = GetTeamSlotBorder(s);
+	if (s)
+	{
+		r.flags       = s->uiStatusFlags & (SOLDIER_DEAD | SOLDIER_DRIVER | SOLDIER_PASSENGER | SOLDIER_VEHICLE);
+		r.stealth     = s->bStealthMode;
+		r.weapon_mode = s->bWeaponMode;
+		r.hand_item[0] = s->inv[HANDPOS].usItem;
+		r.hand_item[1] = s->inv[SECONDHANDPOS].usItem;
+	}
+	return r;
+}
+
+
+static bool operator==(TeamSlotRender const& a, TeamSlotRender const& b)
+{
+	return
+		a.merc         == b.merc         &&
+		a.border       == b.border       &&
+		a.flags        == b.flags        &&
+		a.stealth      == b.stealth      &&
+		a.weapon_mode  == b.weapon_mode  &&
+		a.hand_item[0] == b.hand_item[0] &&
+		a.hand_item[1] == b.hand_item[1];
+}
+
+
+static void SetTeamSlotHelp(TeamPanelSlot& i)
+{
+	SOLDIERTYPE const* const s = i.merc;
+	if (!s) return;
+
+	ST::string help;
+	ST::string help_buf;
+
+	// Add text for first hand popup
+	if (s->uiStatusFlags & SOLDIER_DRIVER)
+	{
+		// Get soldier pointer for vehicle.....
+		SOLDIERTYPE const& vs = GetSoldierStructureForVehicle(GetVehicle(s->iVehicleId));
+		help_buf = st_format_printf(TacticalStr[DRIVER_POPUPTEXT], vs.bLife,
+				vs.bLifeMax, vs.bBreath, vs.bBreathMax);
+		help = help_buf;
+	}
+	else if (s->uiStatusFlags & SOLDIER_DEAD)
+	{
+		help.clear();
+	}
+	else
+	{
+		help_buf = GetHelpTextForItem(s->inv[HANDPOS]);
+		help = help_buf;
+	}
+	i.first_hand.SetFastHelpText(help);
+
+	// Add text for seonc hand popup
+	if (s->uiStatusFlags & (SOLDIER_PASSENGER | SOLDIER_DRIVER))
+	{
+		help = TacticalStr[EXIT_VEHICLE_POPUPTEXT];
+	}
+	else if (s->uiStatusFlags & SOLDIER_DEAD)
+	{
+		help.clear();
+	}
+	else
+	{
+		help_buf = GetHelpTextForItem(s->inv[SECONDHANDPOS]);
+		help = help_buf;
+	}
+	i.second_hand.SetFastHelpText(help);
+}
+
+
+// Face, border and name of a team panel slot, drawn into the save buffer
+static void RenderTeamSlot(TeamPanelSlot const& i, INT32 const dx, INT32 const dy)
+{
+	SOLDIERTYPE const* const s = i.merc;
+	if (s)
+	{
+		RenderSoldierFace(*s, dx + TM_FACE_X, dy + TM_FACE_Y);
+	}
+	else
+	{
+		//BLIT CLOSE PANEL
+		BltVideoObject(guiSAVEBUFFER, guiCLOSE, 5, dx + TM_FACE_X, dy + TM_FACE_Y);
+	}
+
+	RenderTeamSlotBorder(s, dx, dy);
+
+	if (s)
+	{
+		// Render name!
+		UINT8 const foreground = s->bStealthMode ? FONT_MCOLOR_LTYELLOW : FONT_MCOLOR_LTGRAY;
+		SetFontAttributes(BLOCKFONT2, foreground);
+
+		// RENDER ON SAVE BUFFER!
+		SetFontDestBuffer(guiSAVEBUFFER);
+		INT16 sFontX;
+		INT16 sFontY;
+		FindFontCenterCoordinates(dx + TM_NAME_X, dy + TM_NAME_Y, TM_NAME_WIDTH, TM_NAME_HEIGHT,
+						s->name, BLOCKFONT2, &sFontX, &sFontY);
+		MPrint(sFontX, sFontY, s->name);
+		// reset to frame buffer!
+		SetFontDestBuffer(FRAME_BUFFER);
+	}
+}
+
+
 static void RenderSoldierTeamInv(SOLDIERTYPE const&, INT16 x, INT16 y, DirtyLevel);
 static void UpdateTEAMPanel(void);
 
 
 void RenderTEAMPanel(DirtyLevel const dirty_level)
 {
+	if (!IsPanelRenderKept(guiTEAMPanelRenderCycle)) gfTEAMPanelRendered = false;
+
+	// Slots whose hands have to be painted again
+	std::vector<bool> repainted(gTeamPanel.size(), dirty_level == DIRTYLEVEL2);
+
 	if (dirty_level == DIRTYLEVEL2)
 	{
 		MarkAButtonDirty(iTEAMPanelButtons[TEAM_DONE_BUTTON]);
 		MarkAButtonDirty(iTEAMPanelButtons[TEAM_MAP_SCREEN_BUTTON]);
 		MarkAButtonDirty(iTEAMPanelButtons[CHANGE_SQUAD_BUTTON]);
 
-		BltVideoSurface(guiSAVEBUFFER, guiTEAMPanel, INTERFACE_START_X, INTERFACE_START_Y, NULL);
+		// Borders reach into the next slot, so changing one repaints them all
+		bool keep = gfTEAMPanelRendered;
+		for (TeamPanelSlot const& i : gTeamPanel)
+		{
+			if (!keep) break;
+			keep = GetTeamSlotBorder(i.merc) == i.rendered.border;
+		}
 
-		// LOOP THROUGH ALL MERCS ON TEAM PANEL
 		INT32       dx = INTERFACE_START_X;
 		INT32 const dy = INTERFACE_START_Y;
-		for (TeamPanelSlot& i : gTeamPanel)
+		if (keep)
 		{
-			SOLDIERTYPE const* const s  = i.merc;
-			if (s)
-			{
-				RenderSoldierFace(*s, dx + TM_FACE_X, dy + TM_FACE_Y);
-			}
-			else
-			{
-				//BLIT CLOSE PANEL
-				BltVideoObject(guiSAVEBUFFER, guiCLOSE, 5, dx + TM_FACE_X, dy + TM_FACE_Y);
-			}
-
-			RenderTeamSlotBorder(s, dx, dy);
-
-			if (s)
+			for (size_t idx = 0; idx != gTeamPanel.size(); ++idx)
 			{
-				ST::string help;
-				ST::string help_buf;
-
-				// Add text for first hand popup
-				if (s->uiStatusFlags & SOLDIER_DRIVER)
-				{
-					// Get soldier pointer for vehicle.....
-					SOLDIERTYPE const& vs = GetSoldierStructureForVehicle(GetVehicle(s->iVehicleId));
-					help_buf = st_format_printf(TacticalStr[DRIVER_POPUPTEXT], vs.bLife,
-							vs.bLifeMax, vs.bBreath, vs.bBreathMax);
-					help = help_buf;
-				}
-				else if (s->uiStatusFlags & SOLDIER_DEAD)
+				TeamPanelSlot& i = gTeamPanel[idx];
+				TeamSlotRender const render = GetTeamSlotRender(i.merc);
+				if (render == i.rendered)
 				{
-					help.clear();
+					repainted[idx] = false;
+					if (i.merc) RenderSoldierFace(*i.merc, dx + TM_FACE_X, dy + TM_FACE_Y);
 				}
 				else
 				{
-					help_buf = GetHelpTextForItem(s->inv[HANDPOS]);
-					help = help_buf;
-				}
-				i.first_hand.SetFastHelpText(help);
-
-				// Add text for seonc hand popup
-				if (s->uiStatusFlags & (SOLDIER_PASSENGER | SOLDIER_DRIVER))
-				{
-					help = TacticalStr[EXIT_VEHICLE_POPUPTEXT];
-				}
-				else if (s->uiStatusFlags & SOLDIER_DEAD)
-				{
-					help.clear();
+					SGPBox const box = { (UINT16)(dx - INTERFACE_START_X), 0, TM_INV_HAND_SEP, TEAMPANEL_HEIGHT };
+					BltVideoSurface(guiSAVEBUFFER, guiTEAMPanel, dx, dy, &box);
+					RenderTeamSlot(i, dx, dy);
+					// The border of the previous slot reaches into this one
+					if (idx != 0) RenderTeamSlotBorder(gTeamPanel[idx - 1].merc, dx - TM_INV_HAND_SEP, dy);
+					i.rendered = render;
 				}
-				else
-				{
-					help_buf = GetHelpTextForItem(s->inv[SECONDHANDPOS]);
-					help = help_buf;
-				}
-				i.second_hand.SetFastHelpText(help);
-
-				// Restore AP/LIFE POSIITONS
-
-				// Render name!
-				UINT8 const foreground = s->bStealthMode ? FONT_MCOLOR_LTYELLOW : FONT_MCOLOR_LTGRAY;
-				SetFontAttributes(BLOCKFONT2, foreground);
-
-				// RENDER ON SAVE BUFFER!
-				SetFontDestBuffer(guiSAVEBUFFER);
-				INT16 sFontX;
-				INT16 sFontY;
-				FindFontCenterCoordinates(dx + TM_NAME_X, dy + TM_NAME_Y, TM_NAME_WIDTH, TM_NAME_HEIGHT,
-								s->name, BLOCKFONT2, &sFontX, &sFontY);
-				MPrint(sFontX, sFontY, s->name);
-				// reset to frame buffer!
-				SetFontDestBuffer(FRAME_BUFFER);
+				SetTeamSlotHelp(i);
+				dx += TM_INV_HAND_SEP;
 			}
+		}
+		else
+		{
+			BltVideoSurface(guiSAVEBUFFER, guiTEAMPanel, INTERFACE_START_X, INTERFACE_START_Y, NULL);
 
-			dx += TM_INV_HAND_SEP;
+			// LOOP THROUGH ALL MERCS ON TEAM PANEL
+			for (TeamPanelSlot& i : gTeamPanel)
+			{
+				RenderTeamSlot(i, dx, dy);
+				SetTeamSlotHelp(i);
+				i.rendered = GetTeamSlotRender(i.merc);
+				dx += TM_INV_HAND_SEP;
+			}
+			gfTEAMPanelRendered = guiCurrentScreen == GAME_SCREEN;
 		}
 
 		RestoreExternBackgroundRect(INTERFACE_START_X, INTERFACE_START_Y, SCREEN_WIDTH - INTERFACE_START_X,
@@ -2461,8 +2713,9 @@ void RenderTEAMPanel(DirtyLevel const dirty_level)
 	// Loop through all mercs and make go
 	INT32       dx = INTERFACE_START_X;
 	INT32 const dy = INTERFACE_START_Y;
-	for (TeamPanelSlot& i : gTeamPanel)
+	for (size_t idx = 0; idx != gTeamPanel.size(); ++idx)
 	{
+		TeamPanelSlot& i = gTeamPanel[idx];
 		SOLDIERTYPE* const s = i.merc;
 		if (s)
 		{
@@ -2495,7 +2748,9 @@ void RenderTEAMPanel(DirtyLevel const dirty_level)
 				}
 			}
 
-			RenderSoldierTeamInv(*s, dx + TM_INV_HAND1STARTX, dy + TM_INV_HAND1STARTY, dirty_level);
+			// Unchanged hands are still in the save buffer and only need their ammo count
+			DirtyLevel const inv_dirty_level = dirty_level == DIRTYLEVEL2 && !repainted[idx] ? DIRTYLEVEL1 : dirty_level;
+			RenderSoldierTeamInv(*s, dx + TM_INV_HAND1STARTX, dy + TM_INV_HAND1STARTY, inv_dirty_level);
 		}
 		dx += TM_INV_HAND_SEP;
 	}
@@ -3153,6 +3408,7 @@ void InitTEAMSlots()
 	}
 	gTeamPanel.resize(NUM_TEAM_SLOTS);
 	std::fill_n(gTeamPanel.begin(), NUM_TEAM_SLOTS, TeamPanelSlot{NULL});
+	gfTEAMPanelRendered = false;
 }
 
 
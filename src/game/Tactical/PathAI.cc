@@ -29,6 +29,7 @@
 #include "Structure_Wrap.h"
 #include "Keys.h"
 #include "GameSettings.h"
+#include "BattleSimulator.h"
 #include "Buildings.h"
 #include "Logger.h"
 
@@ -456,6 +457,8 @@ static void RestorePathAIToDefaults(void)
 ////////////////////////////////////////////////////////////////////////
 INT32 FindBestPath(SOLDIERTYPE* s, INT16 sDestination, INT8 ubLevel, INT16 usMovementMode, INT8 bCopy, UINT8 fFlags)
 {
+	BattlePhaseTimer const timer(BATTLE_PHASE_PATHFINDING);
+
 	INT32 iDestination = sDestination, iOrigination;
 	UINT8 ubCnt = 0 , ubLoopStart = 0, ubLoopEnd = 0, ubLastDir = 0, ubStructIndex;
 	INT8  bLoopState = LOOPING_CLOCKWISE;
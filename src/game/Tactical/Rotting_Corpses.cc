@@ -47,6 +47,12 @@
 #include "GameInstance.h"
 #include "policy/GamePolicy.h"
 
+#include <string_theory/format>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+
 // If you change MAX_ROTTING_CORPSES you MUST also adjust
 // INVALID_STRUCTURE_ID in Structure.h!
 static_assert(MAX_ROTTING_CORPSES + TOTAL_SOLDIERS == INVALID_STRUCTURE_ID);
@@ -57,6 +63,23 @@ static_assert(MAX_ROTTING_CORPSES + TOTAL_SOLDIERS == INVALID_STRUCTURE_ID);
 #define DELAY_UNTIL_ROTTING			( 1 * NUM_SEC_IN_DAY / 60 )
 #define DELAY_UNTIL_DONE_ROTTING		( 3 * NUM_SEC_IN_DAY / 60 )
 
+
+// Shaded palettes of all corpses in the sector, keyed by appearance
+struct CORPSE_PALETTE
+{
+	UINT16* shades[NUM_CORPSE_SHADES];
+	UINT32  uiRefCount;
+};
+typedef std::map<ST::string, CORPSE_PALETTE> CorpsePaletteMap;
+static CorpsePaletteMap gCorpsePalettes;
+// The same palettes by the shades the corpses point to, to find them when freeing
+static std::map<UINT16* const*, CorpsePaletteMap::iterator> gCorpsePalettesByShades;
+
+/* Corpses which still carry an AI warning. The warning is set to the same
+ * value whenever a corpse is added and decays at the same rate for all of
+ * them, so this is also the order in which they run out. */
+static std::deque<ROTTING_CORPSE*> gCorpsesWithAIWarning;
+
 // When adding a corpse, add struct data...
 static const char* const zCorpseFilenames[NUM_CORPSES] =
 {
@@ -506,6 +529,7 @@ try
 	c->fActivated = TRUE;
 	ani->v.user.uiData = c->ID();
 	c->def.ubAIWarningValue = CORPSE_WARNING_MAX;
+	gCorpsesWithAIWarning.push_back(c);
 
 	SetRenderFlags(RENDER_FLAG_FULL);
 
@@ -546,16 +570,18 @@ catch (...) { return 0; }
 
 static void FreeCorpsePalettes(ROTTING_CORPSE* pCorpse)
 {
-	INT32 cnt;
+	if (!pCorpse->pShades) return;
 
-	for ( cnt = 0; cnt < NUM_CORPSE_SHADES; cnt++ )
-	{
-		if ( pCorpse->pShades[ cnt ] != NULL )
-		{
-			delete[] pCorpse->pShades[ cnt ];
-			pCorpse->pShades[ cnt ] = NULL;
-		}
-	}
+	auto const i = gCorpsePalettesByShades.find(pCorpse->pShades);
+	pCorpse->pShades = NULL;
+	if (i == gCorpsePalettesByShades.end()) return;
+
+	CORPSE_PALETTE& pal = i->second->second;
+	if (--pal.uiRefCount != 0) return;
+
+	for (UINT16* shade : pal.shades) delete[] shade;
+	gCorpsePalettes.erase(i->second);
+	gCorpsePalettesByShades.erase(i);
 }
 
 
@@ -577,6 +603,9 @@ static void RemoveCorpse(ROTTING_CORPSE* const c)
 	c->fActivated = FALSE;
 	DeleteAniTile(c->pAniTile);
 	FreeCorpsePalettes(c);
+
+	auto const i = std::find(gCorpsesWithAIWarning.begin(), gCorpsesWithAIWarning.end(), c);
+	if (i != gCorpsesWithAIWarning.end()) gCorpsesWithAIWarning.erase(i);
 }
 
 
@@ -587,6 +616,20 @@ static void CreateCorpsePalette(ROTTING_CORPSE* const c)
 		c->def.usFlags & ROTTING_CORPSE_USE_CAMO_PALETTE ? ANIMSDIR "/camo.COL" :
 		GetBodyTypePaletteSubstitution(0, c->def.ubBodyType);
 
+	// Everything the palette is made of goes into the key
+	ST::string const& image = gpTileCache[c->pAniTile->sCachedTileID].zName;
+	ST::string const  key   = substitution ?
+		ST::format("{}|{}", image, substitution) :
+		ST::format("{}|{}|{}|{}|{}", image, c->def.HeadPal, c->def.VestPal, c->def.PantsPal, c->def.SkinPal);
+
+	auto const i = gCorpsePalettes.find(key);
+	if (i != gCorpsePalettes.end())
+	{
+		++i->second.uiRefCount;
+		c->pShades = i->second.shades;
+		return;
+	}
+
 	const SGPPaletteEntry* pal;
 	SGPPaletteEntry        tmp_pal[256];
 	if (!substitution)
@@ -609,7 +652,12 @@ static void CreateCorpsePalette(ROTTING_CORPSE* const c)
 		pal = gpTileCache[c->pAniTile->sCachedTileID].pImagery->vo->Palette();
 	}
 
-	CreateBiasedShadedPalettes(c->pShades, pal);
+	auto const added = gCorpsePalettes.emplace(key, CORPSE_PALETTE{}).first;
+	CORPSE_PALETTE& shared = added->second;
+	CreateBiasedShadedPalettes(shared.shades, pal);
+	shared.uiRefCount = 1;
+	c->pShades = shared.shades;
+	gCorpsePalettesByShades[c->pShades] = added;
 }
 
 
@@ -1390,17 +1438,23 @@ INT16 GetGridNoOfCorpseGivenProfileID(const UINT8 ubProfileID)
 
 void DecayRottingCorpseAIWarnings(void)
 {
-	FOR_EACH_ROTTING_CORPSE(c)
+	for (ROTTING_CORPSE* const c : gCorpsesWithAIWarning)
 	{
 		if (c->def.ubAIWarningValue > 0) --c->def.ubAIWarningValue;
 	}
+
+	// The oldest ones run out first
+	while (!gCorpsesWithAIWarning.empty() && gCorpsesWithAIWarning.front()->def.ubAIWarningValue == 0)
+	{
+		gCorpsesWithAIWarning.pop_front();
+	}
 }
 
 
 UINT8 GetNearestRottingCorpseAIWarning(const INT16 sGridNo)
 {
 	UINT8 ubHighestWarning = 0;
-	CFOR_EACH_ROTTING_CORPSE(c)
+	for (ROTTING_CORPSE const* const c : gCorpsesWithAIWarning)
 	{
 		if (c->def.ubAIWarningValue > 0 &&
 			PythSpacesAway(sGridNo, c->def.sGridNo) <= CORPSE_WARNING_DIST &&
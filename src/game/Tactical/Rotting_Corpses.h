@@ -121,7 +121,8 @@ struct ROTTING_CORPSE
 
 	ANITILE *pAniTile;
 
-	UINT16  *pShades[ NUM_CORPSE_SHADES ];
+	// Shaded palettes, shared by all corpses which look the same
+	UINT16* const* pShades;
 };
 
 
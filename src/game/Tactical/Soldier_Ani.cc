@@ -98,7 +98,7 @@ static BOOLEAN HandleUnjamAnimation(SOLDIERTYPE* pSoldier);
 
 BOOLEAN AdjustToNextAnimationFrame( SOLDIERTYPE *pSoldier )
 {
-	UINT16 sNewAniFrame, anAniFrame;
+	UINT16 sNewAniFrame;
 	INT8 ubCurrentHeight;
 	UINT16 usOldAnimState;
 	static UINT32 uiJumpAddress = NO_JUMP;
@@ -114,6 +114,22 @@ BOOLEAN AdjustToNextAnimationFrame( SOLDIERTYPE *pSoldier )
 
 	do
 	{
+		// Plain jumps inside the script only matter to the per step handling
+		// of muzzle flashes and collapsing, otherwise take them all at once
+		if ( pSoldier->bMuzFlashCount == 0 && !pSoldier->bBreathCollapsed )
+		{
+			ANIM_SCRIPT const& script = gAnimScripts[ pSoldier->usAnimState ];
+			pSoldier->usAniCode = script.ops[ pSoldier->usAniCode ].ubTarget;
+
+			// Plain frames need none of the handling below, show them right away
+			if ( script.ops[ pSoldier->usAniCode ].ubType == ANIM_OP_FRAME )
+			{
+				ConvertAniCodeToAniFrame( pSoldier, (INT16)( gusAnimInst[ pSoldier->usAnimState ][ pSoldier->usAniCode ] - 1 ) );
+				pSoldier->usAniCode++;
+				return( TRUE );
+			}
+		}
+
 		// Get new frame code
 		sNewAniFrame = gusAnimInst[ pSoldier->usAnimState ][ pSoldier->usAniCode ];
 
@@ -368,29 +384,19 @@ BOOLEAN AdjustToNextAnimationFrame( SOLDIERTYPE *pSoldier )
 
 				case 436:
 
-					// Loop through script to find entry address
+					// Return to the entry address found when compiling the script
 					if ( uiJumpAddress == NO_JUMP )
 					{
 						break;
 					}
 					usOldAnimState = pSoldier->usAnimState;
-					pSoldier->usAniCode  = 0;
 
-					do
+					if ( gAnimScripts[ uiJumpAddress ].ubReturnHook != NO_RETURN_HOOK )
 					{
-						// Get new frame code
-						anAniFrame = gusAnimInst[ uiJumpAddress ][ pSoldier->usAniCode ];
-
-						if ( anAniFrame == 435 )
-						{
-							// START PROCESSING HERE
-							ChangeSoldierState( pSoldier, (UINT16)uiJumpAddress, pSoldier->usAniCode, FALSE );
-							return( TRUE );
-						}
-						// Adjust frame control pos, and try again
-						pSoldier->usAniCode++;
+						// START PROCESSING HERE
+						ChangeSoldierState( pSoldier, (UINT16)uiJumpAddress, gAnimScripts[ uiJumpAddress ].ubReturnHook, FALSE );
+						return( TRUE );
 					}
-					while( anAniFrame != 999 );
 
 					uiJumpAddress = NO_JUMP;
 
@@ -30,6 +30,7 @@
 #include "Vehicles.h"
 #include "RenderWorld.h"
 #include "AIList.h"
+#include "BattleSimulator.h"
 #include "Soldier_Macros.h"
 #include "Bullets.h"
 #include "Physics.h"
@@ -90,6 +91,8 @@ static void TurnBasedHandleNPCAI(SOLDIERTYPE* pSoldier);
 
 void HandleSoldierAI( SOLDIERTYPE *pSoldier )
 {
+	BattlePhaseTimer const timer(BATTLE_PHASE_AI);
+
 	// ATE
 	// Bail if we are engaged in a NPC conversation/ and/or sequence ... or we have a pause because
 	// we just saw someone... or if there are bombs on the bomb queue
@@ -103,7 +106,7 @@ void HandleSoldierAI( SOLDIERTYPE *pSoldier )
 		return;
 	}
 
-	if (pSoldier->uiStatusFlags & SOLDIER_PC)
+	if (pSoldier->uiStatusFlags & SOLDIER_PC && !gfBattleSimulation)
 	{
 		// if we're in autobandage, or the AI control flag is set and the player has a quote record to perform, or is a boxer,
 		// let AI process this merc; otherwise abort
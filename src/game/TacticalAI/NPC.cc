@@ -36,6 +36,7 @@
 #include "Text.h"
 #include "Timer_Control.h"
 #include "WeaponModels.h"
+#include <map>
 #include <memory>
 #include <string_theory/format>
 #include <string_theory/string>
@@ -160,6 +161,19 @@ static NPCQuoteInfo* gpCivQuoteInfoArray[NUM_CIVQUOTE_SECTORS];
 // Warning: cheap hack approaching
 static BOOLEAN gfTriedToLoadQuoteInfoArray[NUM_PROFILES];
 
+/* Records of a quote array grouped by the conditions which are fixed by the
+ * quote file, bit n stands for record n.  Searches only have to consider the
+ * records of the matching group.  An index is built when its array is first
+ * searched and dropped when the array is freed or records are replaced. */
+struct NPCQuoteIndex
+{
+	UINT64 approach[APPROACH_FRIENDLY_DIRECT_OR_RECRUIT + 1]; // records usable with this approach
+	UINT64 item;                                              // records requiring an item
+};
+static_assert(NUM_NPC_QUOTE_RECORDS <= 64);
+
+static std::map<NPCQuoteInfo const*, NPCQuoteIndex> gNPCQuoteIndex;
+
 INT8 const gbFirstApproachFlags[] = { 0x01, 0x02, 0x04, 0x08 };
 
 
@@ -215,11 +229,77 @@ static NPCQuoteInfo* ExtractNPCQuoteInfoArrayFromFile(HWFILE const f)
 }
 
 
+static void FreeQuoteInfoArray(NPCQuoteInfo*& q)
+{
+	gNPCQuoteIndex.erase(q);
+	FreeNullArray(q);
+}
+
+
+static bool QuoteApproachMatches(NPCQuoteInfo const& q, Approach const approach)
+{
+	// since the "I hate you" code triggers the record, triggering has to work properly
+	// with the other value that is stored!
+	if (!q.ubApproachRequired && (approach == APPROACH_FRIENDLY || approach == APPROACH_DIRECT || approach == TRIGGER_NPC))
+	{
+		return true;
+	}
+
+	switch (q.ubApproachRequired)
+	{
+		case APPROACH_ONE_OF_FOUR_STANDARD:
+			// friendly to recruit will match
+			return APPROACH_FRIENDLY <= approach && approach <= APPROACH_RECRUIT;
+
+		case APPROACH_FRIENDLY_DIRECT_OR_RECRUIT:
+			return approach == APPROACH_FRIENDLY || approach == APPROACH_DIRECT || approach == APPROACH_RECRUIT;
+
+		default:
+			return approach == q.ubApproachRequired;
+	}
+}
+
+
+static NPCQuoteIndex const& GetNPCQuoteIndex(NPCQuoteInfo const* const quotes)
+{
+	auto const it = gNPCQuoteIndex.find(quotes);
+	if (it != gNPCQuoteIndex.end()) return it->second;
+
+	NPCQuoteIndex& idx = gNPCQuoteIndex[quotes];
+	idx = NPCQuoteIndex{};
+	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
+	{
+		NPCQuoteInfo const& q   = quotes[i];
+		UINT64       const  bit = UINT64{1} << i;
+		for (UINT8 a = 0; a != lengthof(idx.approach); ++a)
+		{
+			if (QuoteApproachMatches(q, static_cast<Approach>(a))) idx.approach[a] |= bit;
+		}
+		if (q.sRequiredItem > 0) idx.item |= bit;
+	}
+	return idx;
+}
+
+
+// Get the records of the quote array which can be used with the approach
+static UINT64 GetNPCQuoteCandidates(NPCQuoteInfo const* const quotes, Approach const approach)
+{
+	NPCQuoteIndex const& idx = GetNPCQuoteIndex(quotes);
+	return approach < lengthof(idx.approach) ? idx.approach[approach] : ~UINT64{0};
+}
+
+
+static inline bool IsNPCQuoteCandidate(UINT64 const candidates, UINT8 const record)
+{
+	return (candidates & (UINT64{1} << record)) != 0;
+}
+
+
 static void ConditionalExtractNPCQuoteInfoArrayFromFile(HWFILE const f, NPCQuoteInfo*& q)
 {
 	UINT8 present;
 	f->read(&present, sizeof(present));
-	FreeNullArray(q);
+	FreeQuoteInfoArray(q);
 	if (!present) return;
 	q = ExtractNPCQuoteInfoArrayFromFile(f);
 }
@@ -332,7 +412,7 @@ static void RevertToOriginalQuoteFile(UINT8 ubNPC)
 {
 	if ( gpBackupNPCQuoteInfoArray[ ubNPC ] && gpNPCQuoteInfoArray[ubNPC] )
 	{
-		delete[] gpNPCQuoteInfoArray[ubNPC];
+		FreeQuoteInfoArray(gpNPCQuoteInfoArray[ubNPC]);
 		gpNPCQuoteInfoArray[ubNPC] = gpBackupNPCQuoteInfoArray[ubNPC];
 		gpBackupNPCQuoteInfoArray[ubNPC] = NULL;
 	}
@@ -397,8 +477,8 @@ static NPCQuoteInfo* EnsureQuoteFileLoaded(UINT8 const ubNPC)
 
 bool ReloadQuoteFile(UINT8 const ubNPC)
 {
-	FreeNullArray(gpNPCQuoteInfoArray[ubNPC]);
-	FreeNullArray(gpBackupNPCQuoteInfoArray[ubNPC]);
+	FreeQuoteInfoArray(gpNPCQuoteInfoArray[ubNPC]);
+	FreeQuoteInfoArray(gpBackupNPCQuoteInfoArray[ubNPC]);
 	return EnsureQuoteFileLoaded(ubNPC);
 }
 
@@ -407,7 +487,7 @@ static bool ReloadQuoteFileIfLoaded(UINT8 const ubNPC)
 {
 	NPCQuoteInfo*& q = gpNPCQuoteInfoArray[ubNPC];
 	if (!q) return TRUE;
-	FreeNullArray(q);
+	FreeQuoteInfoArray(q);
 	return EnsureQuoteFileLoaded(ubNPC);
 }
 
@@ -439,6 +519,7 @@ static void RefreshNPCScriptRecord(UINT8 const ubNPC, UINT8 const record)
 	SGP::Buffer<NPCQuoteInfo> new_quotes(LoadQuoteFile(ubNPC));
 	if (!new_quotes) return;
 	q = new_quotes[record];
+	gNPCQuoteIndex.erase(quotes);
 }
 
 
@@ -478,7 +559,7 @@ try
 {
 	NPCQuoteInfo*& q = gpCivQuoteInfoArray[idx];
 	if (!q) return true;
-	FreeNullArray(q);
+	FreeQuoteInfoArray(q);
 	q = LoadCivQuoteFile(idx);
 	return true;
 }
@@ -487,9 +568,9 @@ catch (...) { return false; }
 
 void ShutdownNPCQuotes()
 {
-	FOR_EACH(NPCQuoteInfo*, i, gpNPCQuoteInfoArray)       FreeNullArray(*i);
-	FOR_EACH(NPCQuoteInfo*, i, gpBackupNPCQuoteInfoArray) FreeNullArray(*i);
-	FOR_EACH(NPCQuoteInfo*, i, gpCivQuoteInfoArray)       FreeNullArray(*i);
+	FOR_EACH(NPCQuoteInfo*, i, gpNPCQuoteInfoArray)       FreeQuoteInfoArray(*i);
+	FOR_EACH(NPCQuoteInfo*, i, gpBackupNPCQuoteInfoArray) FreeQuoteInfoArray(*i);
+	FOR_EACH(NPCQuoteInfo*, i, gpCivQuoteInfoArray)       FreeQuoteInfoArray(*i);
 }
 
 
@@ -504,7 +585,7 @@ void ReloadAllQuoteFiles(void)
 		if (!p->isNPCorRPC()) continue;
 
 		// zap backup if any
-		FreeNullArray(gpBackupNPCQuoteInfoArray[p->getID()]);
+		FreeQuoteInfoArray(gpBackupNPCQuoteInfoArray[p->getID()]);
 		ReloadQuoteFileIfLoaded(p->getID());
 	}
 	// reload all civ quote files
@@ -651,18 +732,21 @@ static UINT8 NPCConsiderTalking(UINT8 const ubNPC, UINT8 const ubMerc, Approach
 		}
 	}
 
-	UINT8 first_quote_record;
-	UINT8 last_quote_record;
+	UINT8  first_quote_record;
+	UINT8  last_quote_record;
+	UINT64 candidates;
 	switch (approach)
 	{
 		case TRIGGER_NPC:
 			first_quote_record = record;
 			last_quote_record  = record;
+			candidates         = ~UINT64{0};
 			break;
 
 		default:
 			first_quote_record = 0;
 			last_quote_record  = NUM_NPC_QUOTE_RECORDS - 1;
+			candidates         = GetNPCQuoteCandidates(pNPCQuoteInfoArray, approach);
 			break;
 	}
 
@@ -672,6 +756,7 @@ static UINT8 NPCConsiderTalking(UINT8 const ubNPC, UINT8 const ubMerc, Approach
 	UINT8         ubQuote                  = 0;
 	for (UINT8 i = first_quote_record; i <= last_quote_record; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		pNPCQuoteInfo = &pNPCQuoteInfoArray[i];
 
 		// Check if we have the item / are in right spot
@@ -801,8 +886,12 @@ static UINT8 NPCConsiderReceivingItemFromMerc(UINT8 const ubNPC, UINT8 const ubM
 		SetFactFalse(FACT_ITEM_POOR_CONDITION);
 	}
 
+	UINT64 const candidates =
+		GetNPCQuoteCandidates(pNPCQuoteInfoArray, APPROACH_GIVINGITEM) &
+		GetNPCQuoteIndex(pNPCQuoteInfoArray).item;
 	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		NPCQuoteInfo& q = pNPCQuoteInfoArray[i];
 
 		// First see if we want that item....
@@ -1227,22 +1316,7 @@ static UINT8 NPCConsiderQuote(UINT8 const ubNPC, UINT8 const ubMerc, Approach co
 						ubApproach, pNPCQuoteInfo->ubApproachRequired,
 						(ubApproach != pNPCQuoteInfo->ubApproachRequired) ? "TRUE, return" : "FALSE" );
 		}
-		if ( pNPCQuoteInfo->ubApproachRequired == APPROACH_ONE_OF_FOUR_STANDARD )
-		{
-			// friendly to recruit will match
-			if ( ubApproach < APPROACH_FRIENDLY || ubApproach > APPROACH_RECRUIT )
-			{
-				return( FALSE );
-			}
-		}
-		else if ( pNPCQuoteInfo->ubApproachRequired == APPROACH_FRIENDLY_DIRECT_OR_RECRUIT )
-		{
-			if ( ubApproach != APPROACH_FRIENDLY && ubApproach != APPROACH_DIRECT && ubApproach != APPROACH_RECRUIT )
-			{
-				return( FALSE );
-			}
-		}
-		else if (ubApproach != pNPCQuoteInfo->ubApproachRequired)
+		if (!QuoteApproachMatches(*pNPCQuoteInfo, ubApproach))
 		{
 			return( FALSE );
 		}
@@ -2130,8 +2204,10 @@ void NPCReachedDestination( SOLDIERTYPE * pNPC, BOOLEAN fAlreadyThere )
 		}
 	}
 
+	UINT64 const candidates = GetNPCQuoteCandidates(pNPCQuoteInfoArray, TRIGGER_NPC);
 	for ( ubLoop = 0; ubLoop < NUM_NPC_QUOTE_RECORDS; ubLoop++ )
 	{
+		if (!IsNPCQuoteCandidate(candidates, ubLoop)) continue;
 		pQuotePtr = &(pNPCQuoteInfoArray[ubLoop]);
 		if ( pNPC->sGridNo == -(pQuotePtr->sRequiredGridno ) )
 		{
@@ -2240,8 +2316,10 @@ void PCsNearNPC( UINT8 ubNPC )
 	if (!pSoldier) return;
 	pSoldier->ubQuoteRecord = 0;
 
+	UINT64 const candidates = GetNPCQuoteCandidates(pNPCQuoteInfoArray, TRIGGER_NPC);
 	for ( ubLoop = 0; ubLoop < NUM_NPC_QUOTE_RECORDS; ubLoop++ )
 	{
+		if (!IsNPCQuoteCandidate(candidates, ubLoop)) continue;
 		pQuotePtr = &(pNPCQuoteInfoArray[ubLoop]);
 		if ( pSoldier->sGridNo == -(pQuotePtr->sRequiredGridno ) )
 		{
@@ -2274,8 +2352,10 @@ BOOLEAN PCDoesFirstAidOnNPC( UINT8 ubNPC )
 	// Set flag...
 	gMercProfiles[ ubNPC ].ubMiscFlags2 |= PROFILE_MISC_FLAG2_BANDAGED_TODAY;
 
+	UINT64 const candidates = GetNPCQuoteCandidates(pNPCQuoteInfoArray, TRIGGER_NPC);
 	for ( ubLoop = 0; ubLoop < NUM_NPC_QUOTE_RECORDS; ubLoop++ )
 	{
+		if (!IsNPCQuoteCandidate(candidates, ubLoop)) continue;
 		pQuotePtr = &(pNPCQuoteInfoArray[ubLoop]);
 		if ( pQuotePtr->ubApproachRequired == APPROACH_GIVEFIRSTAID )
 		{
@@ -2362,8 +2442,10 @@ BOOLEAN TriggerNPCWithIHateYouQuote( UINT8 ubTriggerNPC )
 	NPCQuoteInfo* const pNPCQuoteInfoArray = EnsureQuoteFileLoaded(ubTriggerNPC);
 	if (!pNPCQuoteInfoArray) return FALSE; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(pNPCQuoteInfoArray, APPROACH_DECLARATION_OF_HOSTILITY);
 	for ( ubLoop = 0; ubLoop < NUM_NPC_QUOTE_RECORDS; ubLoop++ )
 	{
+		if (!IsNPCQuoteCandidate(candidates, ubLoop)) continue;
 		if ( NPCConsiderQuote( ubTriggerNPC, 0, APPROACH_DECLARATION_OF_HOSTILITY, ubLoop, 0, pNPCQuoteInfoArray ) )
 		{
 			// trigger this quote!
@@ -2384,8 +2466,10 @@ BOOLEAN NPCHasUnusedRecordWithGivenApproach(UINT8 const ubNPC, Approach const ap
 	NPCQuoteInfo* const quotes = EnsureQuoteFileLoaded(ubNPC);
 	if (!quotes) return FALSE; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(quotes, approach);
 	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		if (!NPCConsiderQuote(ubNPC, 0, approach, i, 0, quotes)) continue;
 		return TRUE;
 	}
@@ -2402,8 +2486,10 @@ BOOLEAN NPCHasUnusedHostileRecord(UINT8 const ubNPC, Approach const approach)
 	NPCQuoteInfo* const quotes = EnsureQuoteFileLoaded(ubNPC);
 	if (!quotes) return FALSE; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(quotes, approach);
 	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		if (!NPCConsiderQuote(ubNPC, 0, approach, i, 0, quotes)) continue;
 		NPCQuoteInfo const& q = quotes[i];
 		if (q.usFactMustBeTrue == FACT_NPC_HOSTILE_OR_PISSED_OFF) continue;
@@ -2433,8 +2519,10 @@ BOOLEAN GetInfoForAbandoningEPC(UINT8 const ubNPC, UINT16* const pusQuoteNum, Fa
 	NPCQuoteInfo* const quotes = EnsureQuoteFileLoaded(ubNPC);
 	if (!quotes) return FALSE; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(quotes, APPROACH_EPC_IN_WRONG_SECTOR);
 	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		if (!NPCConsiderQuote(ubNPC, 0, APPROACH_EPC_IN_WRONG_SECTOR, i, 0, quotes)) continue;
 		NPCQuoteInfo const& q = quotes[i];
 		*pusQuoteNum      = q.ubQuoteNum;
@@ -2452,8 +2540,10 @@ BOOLEAN TriggerNPCWithGivenApproach(UINT8 const ubTriggerNPC, Approach const app
 	NPCQuoteInfo* const quotes = EnsureQuoteFileLoaded(ubTriggerNPC);
 	if (!quotes) return FALSE; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(quotes, approach);
 	for (UINT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		if (!NPCConsiderQuote(ubTriggerNPC, 0, approach, i, 0, quotes)) continue;
 
 		bool const show_panel = quotes[i].ubQuoteNum != IRRELEVANT;
@@ -2802,8 +2892,10 @@ INT8 ConsiderCivilianQuotes(const SGPSector& sector, BOOLEAN const set_as_used)
 	NPCQuoteInfo* const quotes = EnsureCivQuoteFileLoaded(quote_file_idx);
 	if (!quotes) return -1; // error
 
+	UINT64 const candidates = GetNPCQuoteCandidates(quotes, APPROACH_NONE);
 	for (INT8 i = 0; i != NUM_NPC_QUOTE_RECORDS; ++i)
 	{
+		if (!IsNPCQuoteCandidate(candidates, i)) continue;
 		if (!NPCConsiderQuote(NO_PROFILE, NO_PROFILE, APPROACH_NONE, i, 0, quotes)) continue;
 		NPCQuoteInfo& q = quotes[i];
 
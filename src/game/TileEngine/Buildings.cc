@@ -13,8 +13,11 @@
 #include "Sys_Globals.h"
 #include "WorldMan.h"
 #include "Logger.h"
+#include "ResourceCache.h"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #define ROOF_LOCATION_CHANCE 8
 
@@ -22,6 +25,18 @@ UINT8						gubBuildingInfo[ WORLD_MAX ];
 BUILDING				gBuildings[ MAX_BUILDINGS ];
 UINT8						gubNumberOfBuildings;
 
+// What GenerateBuildings() found on a map. It only depends on the map file,
+// because buildings are generated before the map modifications are applied.
+struct MAP_BUILDINGS
+{
+	std::vector<std::pair<GridNo, UINT8>> roof_tiles; // gridnos which belong to a building
+	std::vector<BUILDING>                 buildings;  // gBuildings[1] onwards
+};
+
+#define MAP_BUILDINGS_BUDGET (512 * 1024)
+
+static ResourceCache<ST::string, MAP_BUILDINGS> gMapBuildings("Map buildings", MAP_BUILDINGS_BUDGET);
+
 
 static BUILDING* CreateNewBuilding(UINT8* pubBuilding)
 {
@@ -377,7 +392,40 @@ BUILDING * FindBuilding( INT16 sGridNo )
 }
 
 
-void GenerateBuildings( void )
+static void RestoreMapBuildings(MAP_BUILDINGS const& mb)
+{
+	for (auto const& [gridno, id] : mb.roof_tiles)
+	{
+		gubBuildingInfo[gridno] = id;
+	}
+	std::copy(mb.buildings.begin(), mb.buildings.end(), gBuildings + 1);
+	gubNumberOfBuildings = static_cast<UINT8>(mb.buildings.size());
+}
+
+
+static void KeepMapBuildings(const ST::string& map_name)
+{
+	MAP_BUILDINGS mb;
+	for (GridNo i = 0; i < WORLD_MAX; ++i)
+	{
+		if (gubBuildingInfo[i] != NO_BUILDING) mb.roof_tiles.emplace_back(i, gubBuildingInfo[i]);
+	}
+	mb.buildings.assign(gBuildings + 1, gBuildings + 1 + gubNumberOfBuildings);
+
+	size_t const bytes =
+		mb.roof_tiles.size() * sizeof(mb.roof_tiles[0]) +
+		mb.buildings.size()  * sizeof(BUILDING);
+	gMapBuildings.insert(map_name, std::move(mb), bytes);
+}
+
+
+void ForgetMapBuildings()
+{
+	gMapBuildings.clear();
+}
+
+
+void GenerateBuildings(const ST::string& map_name)
 {
 	// init building structures and variables
 	std::fill_n(gubBuildingInfo, WORLD_MAX, 0);
@@ -398,6 +446,12 @@ void GenerateBuildings( void )
 		i->ubExtFlags[0] &= ~MAPELEMENT_EXT_ROOFCODE_VISITED;
 	}
 
+	if (MAP_BUILDINGS const* const mb = map_name.empty() ? nullptr : gMapBuildings.find(map_name))
+	{
+		RestoreMapBuildings(*mb);
+		return;
+	}
+
 	// search through world
 	// for each location in a room try to find building info
 
@@ -408,6 +462,8 @@ void GenerateBuildings( void )
 			GenerateBuilding( loop );
 		}
 	}
+
+	if (!map_name.empty()) KeepMapBuildings(map_name);
 }
 
 INT16 FindClosestClimbPoint( INT16 sStartGridNo, INT16 sDesiredGridNo, BOOLEAN fClimbUp )
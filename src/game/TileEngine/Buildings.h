@@ -3,6 +3,9 @@
 #define BUILDING_H
 
 #include "WorldDef.h"
+
+#include <string_theory/string>
+
 // for what it's worth, 2 bytes, we use roof climb spots as 1-based
 // so the 0th entry is always 0 and can be compared with (and not equal)
 // NOWHERE or any other location
@@ -23,7 +26,11 @@ struct BUILDING
 extern UINT8 gubBuildingInfo[ WORLD_MAX ];
 
 BUILDING * FindBuilding( INT16 sGridNo );
-void GenerateBuildings( void );
+// The map name, if given, keeps the buildings found on the map so they are
+// restored instead of generated when the same map is loaded again
+void GenerateBuildings(const ST::string& map_name = ST::string());
+// Drop the buildings kept for all maps, when a map has been saved
+void ForgetMapBuildings();
 INT16 FindClosestClimbPoint( INT16 sStartGridNo, INT16 sDesiredGridNo, BOOLEAN fClimbUp );
 BOOLEAN SameBuilding( INT16 sGridNo1, INT16 sGridNo2 );
 
@@ -221,6 +221,7 @@ void EnvironmentController( BOOLEAN fCheckForLights )
 			}
 
 
+			// Relights the world and redraws all switched on light sprites at once
 			LightSetBaseLevel( ubLightAdjustFromWeather );
 
 			//Update Merc Lights since the above function modifies it.
@@ -421,61 +422,63 @@ void EnvEndRainStorm( )
 }
 
 
-void TurnOnNightLights()
+/* Switches the time of day lights with the given flag on or off and returns
+ * whether any of them changed. Only the flags are set here, the lights are
+ * drawn by the next relight of the EnvironmentController. */
+static BOOLEAN PowerTimeOfDayLights(UINT32 const light_flag, BOOLEAN const on)
 {
+	BOOLEAN changed = FALSE;
 	FOR_EACH_LIGHT_SPRITE(l)
 	{
-		if (l->uiFlags & LIGHT_NIGHTTIME &&
-			!(l->uiFlags & (LIGHT_SPR_ON | MERC_LIGHT)))
-		{
-			LightSpritePower(l, TRUE);
-		}
+		if (!(l->uiFlags & light_flag)) continue;
+		if (l->uiFlags & MERC_LIGHT)    continue;
+		BOOLEAN const is_on = (l->uiFlags & LIGHT_SPR_ON) != 0;
+		if (is_on == on) continue;
+		LightSpritePower(l, on);
+		changed = TRUE;
 	}
+	return changed;
+}
+
+
+/* Collects the lighting changes of the time of day events. The ambient level
+ * and all lights switched until the next environment tick are relit together,
+ * with a single render invalidation. */
+static void RequestTimeOfDayRelight(BOOLEAN const changed)
+{
+	if (changed && !gfBasement && !gfCaves) gfDoLighting = TRUE;
+}
+
+
+void TurnOnNightLights()
+{
+	RequestTimeOfDayRelight(PowerTimeOfDayLights(LIGHT_NIGHTTIME, TRUE));
 }
 
 
 void TurnOffNightLights()
 {
-	FOR_EACH_LIGHT_SPRITE(l)
-	{
-		if (l->uiFlags & LIGHT_NIGHTTIME &&
-			l->uiFlags & LIGHT_SPR_ON &&
-			!(l->uiFlags & MERC_LIGHT))
-		{
-			LightSpritePower(l, FALSE);
-		}
-	}
+	RequestTimeOfDayRelight(PowerTimeOfDayLights(LIGHT_NIGHTTIME, FALSE));
 }
 
 
 void TurnOnPrimeLights()
 {
-	FOR_EACH_LIGHT_SPRITE(l)
-	{
-		if (l->uiFlags & LIGHT_PRIMETIME &&
-				!(l->uiFlags & (LIGHT_SPR_ON | MERC_LIGHT)))
-		{
-			LightSpritePower(l, TRUE);
-		}
-	}
+	RequestTimeOfDayRelight(PowerTimeOfDayLights(LIGHT_PRIMETIME, TRUE));
 }
 
 
 void TurnOffPrimeLights()
 {
-	FOR_EACH_LIGHT_SPRITE(l)
-	{
-		if (l->uiFlags & LIGHT_PRIMETIME &&
-			l->uiFlags & LIGHT_SPR_ON &&
-			!(l->uiFlags & MERC_LIGHT))
-		{
-			LightSpritePower(l, FALSE);
-		}
-	}
+	RequestTimeOfDayRelight(PowerTimeOfDayLights(LIGHT_PRIMETIME, FALSE));
 }
 
+
 void UpdateTemperature( UINT8 ubTemperatureCode )
 {
+	UINT8 const ubOldDesertTemperature = gubDesertTemperature;
+	UINT8 const ubOldGlobalTemperature = gubGlobalTemperature;
+
 	switch( ubTemperatureCode )
 	{
 		case TEMPERATURE_DESERT_COOL:
@@ -497,7 +500,10 @@ void UpdateTemperature( UINT8 ubTemperatureCode )
 			gubGlobalTemperature = 2;
 			break;
 	}
-	gfDoLighting = TRUE;
+
+	// Hot sectors are lit differently, relight only if that can have changed
+	RequestTimeOfDayRelight(gubDesertTemperature != ubOldDesertTemperature ||
+		gubGlobalTemperature != ubOldGlobalTemperature);
 }
 
 INT8 SectorTemperature(UINT32 uiTime, const SGPSector& sector)
@@ -57,8 +57,25 @@ INT16 gsBRGridNo = 12635;
 
 extern UINT8 gubTacticalDirection;
 
+// Index for the closest edgepoint searches, built once per set of edgepoints.
+// A multi-source breadth first search from all edgepoints of a list yields the
+// number of spiral rings from any gridno to the closest of them, so a search
+// can skip the rings which cannot hold one of its edgepoints.
+#define NUM_EDGEPOINT_LISTS 8
+
+struct EDGEPOINT_INDEX
+{
+	bool               fValid = false;
+	std::vector<UINT8> ubLists;                       // bit per list the gridno is an edgepoint of
+	std::vector<UINT8> ubRings[NUM_EDGEPOINT_LISTS]; // rings to the closest edgepoint of each list
+};
+
+static EDGEPOINT_INDEX gEdgepointIndex;
+
+
 void TrashMapEdgepoints()
 {
+	gEdgepointIndex.fValid = false;
 	//Primary edgepoints
 	gps1stNorthEdgepointArray.clear();
 	gps1stEastEdgepointArray.clear();
@@ -947,6 +964,73 @@ void ChooseMapEdgepoints(MAPEDGEPOINTINFO* const pMapEdgepointInfo, const UINT8
 INT16 *gpReservedGridNos = NULL;
 INT16 gsReservedIndex	= 0;
 
+
+static std::vector<INT16>& GetEdgepointList(UINT8 const list)
+{
+	static std::vector<INT16>* const lists[NUM_EDGEPOINT_LISTS] =
+	{
+		&gps1stNorthEdgepointArray, &gps1stSouthEdgepointArray, &gps1stEastEdgepointArray, &gps1stWestEdgepointArray,
+		&gps2ndNorthEdgepointArray, &gps2ndSouthEdgepointArray, &gps2ndEastEdgepointArray, &gps2ndWestEdgepointArray
+	};
+	return *lists[list];
+}
+
+
+static void FindEdgepointRings(std::vector<INT16> const& edgepoints, std::vector<UINT8>& rings)
+{
+	// Same steps as the spiral search, so the result is a lower bound of the
+	// ring it finds an edgepoint on
+	static INT16 const steps[] =
+	{
+		-WORLD_COLS - 1, -WORLD_COLS, -WORLD_COLS + 1, -1, 1, WORLD_COLS - 1, WORLD_COLS, WORLD_COLS + 1
+	};
+
+	rings.assign(WORLD_MAX, UINT8_MAX);
+	std::vector<INT16> queue;
+	queue.reserve(WORLD_MAX);
+	for (INT16 const edgepoint : edgepoints)
+	{
+		if (edgepoint < 0 || edgepoint >= WORLD_MAX || rings[edgepoint] == 0) continue;
+		rings[edgepoint] = 0;
+		queue.push_back(edgepoint);
+	}
+
+	for (size_t head = 0; head != queue.size(); ++head)
+	{
+		INT16 const gridno = queue[head];
+		UINT8 const ring   = rings[gridno] + 1;
+		if (ring == UINT8_MAX) continue;
+		for (INT16 const step : steps)
+		{
+			INT32 const next = gridno + step;
+			if (next < 0 || next >= WORLD_MAX || rings[next] != UINT8_MAX) continue;
+			rings[next] = ring;
+			queue.push_back(static_cast<INT16>(next));
+		}
+	}
+}
+
+
+static void BuildEdgepointIndex()
+{
+	EDGEPOINT_INDEX& idx = gEdgepointIndex;
+	if (idx.fValid) return;
+
+	idx.ubLists.assign(WORLD_MAX, 0);
+	for (UINT8 list = 0; list != NUM_EDGEPOINT_LISTS; ++list)
+	{
+		std::vector<INT16> const& edgepoints = GetEdgepointList(list);
+		for (INT16 const edgepoint : edgepoints)
+		{
+			if (edgepoint < 0 || edgepoint >= WORLD_MAX) continue;
+			idx.ubLists[edgepoint] |= 1U << list;
+		}
+		FindEdgepointRings(edgepoints, idx.ubRings[list]);
+	}
+	idx.fValid = true;
+}
+
+
 void BeginMapEdgepointSearch()
 {
 	INT16 sGridNo;
@@ -956,6 +1040,8 @@ void BeginMapEdgepointSearch()
 	gpReservedGridNos = new INT16[20]{};
 	gsReservedIndex   = 0;
 
+	BuildEdgepointIndex();
+
 	if( gMapInformation.sNorthGridNo != -1 )
 		sGridNo = gMapInformation.sNorthGridNo;
 	else if( gMapInformation.sEastGridNo != -1 )
@@ -981,189 +1067,68 @@ void EndMapEdgepointSearch()
 }
 
 
-//THIS CODE ISN'T RECOMMENDED FOR TIME CRITICAL AREAS.
-INT16 SearchForClosestPrimaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCode )
+static bool IsEdgepointAvailable(INT16 const sGridNo, UINT8 const list)
 {
-	INT32 i, iDirectionLoop;
-	std::vector<INT16>* pEdgepoints = nullptr;
-	INT16 sRadius, sDistance, sDirection, sOriginalGridNo;
-	BOOLEAN fReserved;
-
-	if( gsReservedIndex >= 20 )
-	{ //Everything is reserved.
-		SLOGA("All closest map edgepoints have been reserved.  We should only have 20 soldiers maximum...");
-	}
-	switch( ubInsertionCode )
-	{
-		case INSERTION_CODE_NORTH:
-			pEdgepoints = &gps1stNorthEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any north mapedgepoints. LC:1", gWorldSector));
-			break;
-		case INSERTION_CODE_EAST:
-			pEdgepoints = &gps1stEastEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any east mapedgepoints. LC:1", gWorldSector));
-			break;
-		case INSERTION_CODE_SOUTH:
-			pEdgepoints = &gps1stSouthEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any south mapedgepoints. LC:1", gWorldSector));
-			break;
-		case INSERTION_CODE_WEST:
-			pEdgepoints = &gps1stWestEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any west mapedgepoints. LC:1", gWorldSector));
-			break;
-	}
-	if (!pEdgepoints || pEdgepoints->size() == 0)
+	if (!(gEdgepointIndex.ubLists[sGridNo] & (1U << list))) return false;
+	for (INT32 i = 0; i < gsReservedIndex; i++)
 	{
-		return NOWHERE;
+		if (gpReservedGridNos[i] == sGridNo) return false;
 	}
+	return true;
+}
 
-	//Check the initial gridno, to see if it is available and an edgepoint.
-	fReserved = FALSE;
-	for( i = 0; i < gsReservedIndex; i++ )
-	{
-		if( gpReservedGridNos[ i ] == sGridNo )
-		{
-			fReserved = TRUE;
-			break;
-		}
-	}
-	if( !fReserved )
-	{	//Not reserved, so see if we can find this gridno in the edgepoint array.
-		for (INT16 edgepoint : *pEdgepoints)
-		{
-			if (edgepoint == sGridNo)
-			{ //Yes, the gridno is in the edgepoint array.
-				gpReservedGridNos[ gsReservedIndex ] = sGridNo;
-				gsReservedIndex++;
-				return sGridNo;
-			}
-		}
-	}
 
-	//spiral outwards, until we find an unreserved mapedgepoint.
-	//
-	// 09 08 07 06
-	// 10	01 00 05
-	// 11 02 03 04
-	// 12 13 14 15 ..
-	sRadius = 1;
-	sDirection = WORLD_COLS;
-	sOriginalGridNo = sGridNo;
-	while (sRadius < (INT16)(gWorldSector.z ? 30 : 10))
-	{
-		sGridNo = sOriginalGridNo + (-1 - WORLD_COLS)*sRadius; //start at the TOP-LEFT gridno
-		for( iDirectionLoop = 0; iDirectionLoop < 4; iDirectionLoop++ )
-		{
-			switch( iDirectionLoop )
-			{
-				case 0:	sDirection = WORLD_COLS;	break;
-				case 1:	sDirection = 1;						break;
-				case 2:	sDirection = -WORLD_COLS;	break;
-				case 3:	sDirection = -1;					break;
-			}
-			sDistance = sRadius * 2;
-			while( sDistance-- )
-			{
-				sGridNo += sDirection;
-				if( sGridNo < 0 || sGridNo >= WORLD_MAX )
-					continue;
-				//Check the gridno, to see if it is available and an edgepoint.
-				fReserved = FALSE;
-				for( i = 0; i < gsReservedIndex; i++ )
-				{
-					if( gpReservedGridNos[ i ] == sGridNo )
-					{
-						fReserved = TRUE;
-						break;
-					}
-				}
-				if( !fReserved )
-				{	//Not reserved, so see if we can find this gridno in the edgepoint array.
-					for (INT16 edgepoint : *pEdgepoints)
-					{
-						if (edgepoint == sGridNo)
-						{ //Yes, the gridno is in the edgepoint array.
-							gpReservedGridNos[ gsReservedIndex ] = sGridNo;
-							gsReservedIndex++;
-							return sGridNo;
-						}
-					}
-				}
-			}
-		}
-		sRadius++;
-	}
-	return NOWHERE ;
+static INT16 ReserveEdgepoint(INT16 const sGridNo)
+{
+	gpReservedGridNos[ gsReservedIndex ] = sGridNo;
+	gsReservedIndex++;
+	return sGridNo;
 }
 
-INT16 SearchForClosestSecondaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCode )
+
+//THIS CODE ISN'T RECOMMENDED FOR TIME CRITICAL AREAS.
+static INT16 SearchForClosestMapEdgepoint(INT16 sGridNo, UINT8 const ubInsertionCode, bool const fSecondary)
 {
-	INT32 i, iDirectionLoop;
-	std::vector<INT16>* pEdgepoints = nullptr;
+	INT32 iDirectionLoop;
 	INT16 sRadius, sDistance, sDirection, sOriginalGridNo;
-	BOOLEAN fReserved;
 
 	if( gsReservedIndex >= 20 )
 	{ //Everything is reserved.
 		SLOGA("All closest map edgepoints have been reserved.  We should only have 20 soldiers maximum...");
 	}
-	switch( ubInsertionCode )
+	if (ubInsertionCode > INSERTION_CODE_WEST)
 	{
-		case INSERTION_CODE_NORTH:
-			pEdgepoints = &gps2ndNorthEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any isolated north mapedgepoints. KM:1", gWorldSector));
-			break;
-		case INSERTION_CODE_EAST:
-			pEdgepoints = &gps2ndEastEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any isolated east mapedgepoints. KM:1", gWorldSector));
-			break;
-		case INSERTION_CODE_SOUTH:
-			pEdgepoints = &gps2ndSouthEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any isolated south mapedgepoints. KM:1", gWorldSector));
-			break;
-		case INSERTION_CODE_WEST:
-			pEdgepoints = &gps2ndWestEdgepointArray;
-			AssertMsg(pEdgepoints->size() != 0, ST::format("Sector {} doesn't have any isolated west mapedgepoints. KM:1", gWorldSector));
-			break;
+		return NOWHERE;
 	}
-	if (!pEdgepoints || pEdgepoints->size() == 0)
+	UINT8 const list = ubInsertionCode + (fSecondary ? 4 : 0);
+	if (GetEdgepointList(list).empty())
+	{
+		static char const* const sides[] = { "north", "south", "east", "west" };
+		AssertMsg(false, ST::format("Sector {} doesn't have any {}{} mapedgepoints.", gWorldSector, fSecondary ? "isolated " : "", sides[ubInsertionCode]));
+		return NOWHERE;
+	}
+	if (sGridNo < 0 || sGridNo >= WORLD_MAX)
 	{
 		return NOWHERE;
 	}
 
 	//Check the initial gridno, to see if it is available and an edgepoint.
-	fReserved = FALSE;
-	for( i = 0; i < gsReservedIndex; i++ )
+	if (IsEdgepointAvailable(sGridNo, list))
 	{
-		if( gpReservedGridNos[ i ] == sGridNo )
-		{
-			fReserved = TRUE;
-			break;
-		}
-	}
-	if( !fReserved )
-	{	//Not reserved, so see if we can find this gridno in the edgepoint array.
-		for (INT16 edgepoint : *pEdgepoints)
-		{
-			if (edgepoint == sGridNo)
-			{ //Yes, the gridno is in the edgepoint array.
-				gpReservedGridNos[ gsReservedIndex ] = sGridNo;
-				gsReservedIndex++;
-				return sGridNo;
-			}
-		}
+		return ReserveEdgepoint(sGridNo);
 	}
 
 	//spiral outwards, until we find an unreserved mapedgepoint.
+	//The rings closer than the nearest edgepoint of the list are skipped.
 	//
 	// 09 08 07 06
 	// 10	01 00 05
 	// 11 02 03 04
 	// 12 13 14 15 ..
-	sRadius = 1;
+	sRadius = std::max<INT16>(1, gEdgepointIndex.ubRings[list][sGridNo]);
 	sDirection = WORLD_COLS;
 	sOriginalGridNo = sGridNo;
-	while( sRadius < (INT16)(gWorldSector.z ? 30 : 10) )
+	while (sRadius < (INT16)(gWorldSector.z ? 30 : 10))
 	{
 		sGridNo = sOriginalGridNo + (-1 - WORLD_COLS)*sRadius; //start at the TOP-LEFT gridno
 		for( iDirectionLoop = 0; iDirectionLoop < 4; iDirectionLoop++ )
@@ -1182,26 +1147,9 @@ INT16 SearchForClosestSecondaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCod
 				if( sGridNo < 0 || sGridNo >= WORLD_MAX )
 					continue;
 				//Check the gridno, to see if it is available and an edgepoint.
-				fReserved = FALSE;
-				for( i = 0; i < gsReservedIndex; i++ )
+				if (IsEdgepointAvailable(sGridNo, list))
 				{
-					if( gpReservedGridNos[ i ] == sGridNo )
-					{
-						fReserved = TRUE;
-						break;
-					}
-				}
-				if( !fReserved )
-				{	//Not reserved, so see if we can find this gridno in the edgepoint array.
-					for (INT16 edgepoint : *pEdgepoints)
-					{
-						if (edgepoint == sGridNo)
-						{ //Yes, the gridno is in the edgepoint array.
-							gpReservedGridNos[ gsReservedIndex ] = sGridNo;
-							gsReservedIndex++;
-							return sGridNo;
-						}
-					}
+					return ReserveEdgepoint(sGridNo);
 				}
 			}
 		}
@@ -1211,6 +1159,18 @@ INT16 SearchForClosestSecondaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCod
 }
 
 
+INT16 SearchForClosestPrimaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCode )
+{
+	return SearchForClosestMapEdgepoint(sGridNo, ubInsertionCode, false);
+}
+
+
+INT16 SearchForClosestSecondaryMapEdgepoint( INT16 sGridNo, UINT8 ubInsertionCode )
+{
+	return SearchForClosestMapEdgepoint(sGridNo, ubInsertionCode, true);
+}
+
+
 #define EDGE_OF_MAP_SEARCH 5
 
 
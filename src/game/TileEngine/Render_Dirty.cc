@@ -575,3 +575,27 @@ void SetVideoOverlayPos(VIDEO_OVERLAY* const v, const INT16 X, const INT16 Y)
 		v->sY         = Y;
 	}
 }
+
+
+bool SetVideoOverlayArea(VIDEO_OVERLAY* const v, INT16 const x, INT16 const y, INT16 const w, INT16 const h)
+{
+	if (!v) return false;
+
+	BACKGROUND_SAVE* const bgs = RegisterBackgroundRect(BGND_FLAG_PERMANENT, x, y, w, h);
+	if (!bgs) return false;
+
+	// While scrolling, the save area was sized for the old rect. Drop it, so
+	// SaveVideoOverlaysArea() allocates one of the new size.
+	BACKGROUND_SAVE* const old = v->background;
+	if (old->sWidth != bgs->sWidth || old->sHeight != bgs->sHeight)
+	{
+		v->pSaveArea.reset();
+	}
+
+	FreeBackgroundRectPending(old);
+	v->background = bgs;
+	v->background->fDisabled = v->fDisabled;
+	v->sX = x;
+	v->sY = y;
+	return true;
+}
@@ -105,6 +105,9 @@ inline void SetVideoOverlayText(VIDEO_OVERLAY* v, const ST::string& str)
 	SetVideoOverlayText(v, str.to_utf32());
 }
 void SetVideoOverlayPos(VIDEO_OVERLAY*, INT16 X, INT16 Y);
+// Moves an overlay without text and changes the area it saves the background of.
+// Returns false and leaves the overlay as it is if the area is clipped away.
+bool SetVideoOverlayArea(VIDEO_OVERLAY*, INT16 x, INT16 y, INT16 w, INT16 h);
 
 void BlitBufferToBuffer(SGPVSurface* src, SGPVSurface* dst, UINT16 usSrcX, UINT16 usSrcY, UINT16 usWidth, UINT16 usHeight);
 
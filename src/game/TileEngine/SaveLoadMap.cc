@@ -408,6 +408,7 @@ static void AddBloodOrSmellFromMapTempFileToMap(MODIFY_MAP* pMap)
 	}
 
 	gpWorldLevelData[ pMap->usGridNo ].ubSmellInfo = (UINT8)pMap->usSubImageIndex;
+	MarkBloodOrSmellTile(pMap->usGridNo);
 }
 
 
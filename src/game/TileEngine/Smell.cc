@@ -13,6 +13,10 @@
 #include "Game_Clock.h"
 #include "Overhead.h"
 
+#include <algorithm>
+#include <bitset>
+#include <vector>
+
 
 /*
  * Smell & Blood system
@@ -120,6 +124,28 @@ constexpr UINT8 BLOOD_DELAY_MAX = 3;
 	SET_BLOOD_FLOOR_STRENGTH( (b), ubRoofStrength ); \
 }
 
+// Tiles that may have blood or smell on them. Almost all tiles of a map are
+// clean, so decaying only these is much cheaper than a sweep of the world.
+// Tiles which became clean are dropped on the next decay.
+static std::vector<GridNo>   g_blood_smell_tiles;
+static std::bitset<WORLD_MAX> g_blood_smell_tracked;
+
+
+void MarkBloodOrSmellTile(GridNo const gridno)
+{
+	if (g_blood_smell_tracked[gridno]) return;
+	g_blood_smell_tracked[gridno] = true;
+	g_blood_smell_tiles.push_back(gridno);
+}
+
+
+void ResetBloodAndSmells()
+{
+	g_blood_smell_tiles.clear();
+	g_blood_smell_tracked.reset();
+}
+
+
 static void SetRandomBloodDecayTime(MAP_ELEMENT & me)
 {
 	me.ubBloodInfo &= 0b1111'1100;
@@ -153,23 +179,45 @@ void RemoveBlood(GridNo const gridno, INT8 const level)
 }
 
 
+static void DecaySmell(MAP_ELEMENT& me)
+{
+	UINT8& smell = me.ubSmellInfo;
+	if (smell == 0) return;
+	DECAY_SMELL_STRENGTH(smell);
+	// If the strength left is 0, wipe the whole byte to clear the type
+	if (SMELL_STRENGTH(smell) == 0) smell = 0;
+}
+
+
+// Drop the tiles without any blood or smell left from the active set
+static void ForgetCleanTiles()
+{
+	auto const clean = [](GridNo const gridno)
+	{
+		MAP_ELEMENT const& me = gpWorldLevelData[gridno];
+		if (me.ubBloodInfo != 0 || me.ubSmellInfo != 0) return false;
+		g_blood_smell_tracked[gridno] = false;
+		return true;
+	};
+	g_blood_smell_tiles.erase(std::remove_if(g_blood_smell_tiles.begin(), g_blood_smell_tiles.end(), clean), g_blood_smell_tiles.end());
+}
+
+
 void DecaySmells()
 {
-	FOR_EACH_WORLD_TILE(i)
+	for (GridNo const gridno : g_blood_smell_tiles)
 	{
-		UINT8& smell = i->ubSmellInfo;
-		if (smell == 0) continue;
-		DECAY_SMELL_STRENGTH(smell);
-		// If the strength left is 0, wipe the whole byte to clear the type
-		if (SMELL_STRENGTH(smell) == 0) smell = 0;
+		DecaySmell(gpWorldLevelData[gridno]);
 	}
+	ForgetCleanTiles();
 }
 
 
 static void DecayBlood(void)
 {
-	FOR_EACH_WORLD_TILE(pMapElement)
+	for (GridNo const gridno : g_blood_smell_tiles)
 	{
+		MAP_ELEMENT* const pMapElement = &gpWorldLevelData[gridno];
 		if (pMapElement->ubBloodInfo)
 		{
 			// delay blood timer!
@@ -255,7 +303,7 @@ void DecayBloodAndSmells( UINT32 uiTime )
 	{
 		gTacticalStatus.uiDecayBloodLastUpdate = uiTime;
 		DecayBlood();
-		DecaySmells();
+		DecaySmells(); // also drops the tiles that became clean
 	}
 }
 
@@ -340,6 +388,8 @@ void DropSmell(SOLDIERTYPE& s)
 			// the simple case, dropping a smell in a location where there is none
 			SET_SMELL( pMapElement->ubSmellInfo, ubStrength, ubSmell );
 		}
+
+		if (pMapElement->ubSmellInfo) MarkBloodOrSmellTile(s.sGridNo);
 	}
 	// otherwise skip dropping smell
 }
@@ -427,6 +477,7 @@ void InternalDropBlood(GridNo const gridno, INT8 const level, BloodKind const bl
 	}
 
 	me.uiFlags |= MAPELEMENT_REEVALUATEBLOOD;
+	MarkBloodOrSmellTile(gridno);
 
 	if (visible != -1) UpdateBloodGraphics(gridno, level);
 }
@@ -26,3 +26,9 @@ void DropBlood(SOLDIERTYPE const&, UINT8 strength);
 void UpdateBloodGraphics(GridNo, INT8 level);
 void RemoveBlood(GridNo, INT8 level);
 void InternalDropBlood(GridNo, INT8 level, BloodKind, UINT8 strength, INT8 visible);
+
+// Blood and smell only decay on tracked tiles. Code which sets the blood or
+// smell byte of a tile directly has to mark it.
+void MarkBloodOrSmellTile(GridNo);
+// Forget all tracked tiles, when the world is trashed
+void ResetBloodAndSmells();
@@ -44,6 +44,7 @@
 #include "ScreenIDs.h"
 #include "SGPFile.h"
 #include "SGPStrings.h"
+#include "Smell.h"
 #include "SmokeEffects.h"
 #include "Soldier_Control.h"
 #include "Soldier_Create.h"
@@ -1345,6 +1346,9 @@ static void SaveMapLights(HWFILE);
 BOOLEAN SaveWorldToSGPFile(SGPFile* f)
 try
 {
+	// The saved map may replace one whose buildings are kept
+	ForgetMapBuildings();
+
 	// Write JA2 Version ID
 	FLOAT mapVersion = getMajorMapVersion();
 	f->write(&mapVersion, sizeof(FLOAT));
@@ -2028,13 +2032,11 @@ catch (...) { return FALSE; }
 
 static void LoadMapLights(HWFILE);
 
-void LoadWorldFromSGPFile(SGPFile *f);
-
 void LoadWorld(const ST::string &name)
 try
 {
 	AutoSGPFile f(GCM->openMapForReading(name));
-	LoadWorldFromSGPFile(f);
+	LoadWorldFromSGPFile(f, name);
 }
 catch (const std::runtime_error& err)
 {
@@ -2055,7 +2057,7 @@ catch (const std::runtime_error& err)
 }
 
 /// Internal load world that reads from sgp file
-void LoadWorldFromSGPFile(SGPFile *f)
+void LoadWorldFromSGPFile(SGPFile *f, const ST::string& map_name)
 {
 	// Reset flags for outdoors/indoors
 	gfBasement = FALSE;
@@ -2493,7 +2495,7 @@ void LoadWorldFromSGPFile(SGPFile *f)
 
 	gfWorldLoaded = TRUE;
 
-	GenerateBuildings();
+	GenerateBuildings(map_name);
 
 	RenderProgressBar(0, 100);
 }
@@ -2594,6 +2596,7 @@ void TrashWorld(void)
 
 	// Zero world
 	std::fill_n(gpWorldLevelData, WORLD_MAX, MAP_ELEMENT{});
+	ResetBloodAndSmells();
 
 	// Set some default flags
 	FOR_EACH_WORLD_TILE(i)
@@ -270,7 +270,8 @@ BOOLEAN SaveWorldToSGPFile(SGPFile* f);
 
 void LoadWorldAbsolute(const ST::string &absolutePath);
 void LoadWorld(const ST::string &name);
-void LoadWorldFromSGPFile(SGPFile* f);
+// The map name, if known, is used to recognize a map that is loaded again
+void LoadWorldFromSGPFile(SGPFile* f, const ST::string& map_name = ST::string());
 void CompileWorldMovementCosts(void);
 void RecompileLocalMovementCosts( INT16 sCentreGridNo );
 void RecompileLocalMovementCostsFromRadius( INT16 sCentreGridNo, INT8 bRadius );
@@ -1175,7 +1175,7 @@ static CursorData CursorDatabase[] =
 #undef SUBNORM
 
 
-static void BltJA2CursorData(void);
+static bool BltJA2CursorData(void);
 
 
 void InitCursors(void)
@@ -1222,15 +1222,16 @@ void HandleAnimatedCursors(void)
 }
 
 
-static void DrawMouseText(void);
+static bool DrawMouseText(void);
 
 
-static void BltJA2CursorData(void)
+static bool BltJA2CursorData(void)
 {
 	if (gViewportRegion.uiFlags & MSYS_MOUSE_IN_AREA || IsPointerOnTacticalTouchUI())
 	{
-		DrawMouseText();
+		return DrawMouseText();
 	}
+	return false;
 }
 
 
@@ -1274,7 +1275,7 @@ void SetChanceToHitText(const ST::string& str)
 	gzHitChance = str;
 }
 
-static void DrawMouseText(void)
+static bool DrawMouseText(void)
 {
 	static BOOLEAN fShow = FALSE;
 	static BOOLEAN fHoldInvalid = TRUE;
@@ -1433,6 +1434,9 @@ static void DrawMouseText(void)
 		}
 	}
 #endif
+
+	return !gzLocation.empty() || !gzIntTileLocation.empty() || !gzIntTileLocation2.empty() ||
+		!gzHitChance.empty() || gfUIDisplayActionPoints;
 }
 
 
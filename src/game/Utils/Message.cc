@@ -3,7 +3,6 @@
 #include "Directories.h"
 #include "Font.h"
 #include "LoadSaveData.h"
-#include "PODObj.h"
 #include "Types.h"
 #include "Font_Control.h"
 #include "Message.h"
@@ -26,19 +25,35 @@
 
 #include <string_theory/string>
 
+#include <algorithm>
+#include <optional>
 
+
+// A line of the map screen message log
 struct ScrollStringSt
 {
 	ST::string pString;
-	VIDEO_OVERLAY* video_overlay;
 	UINT16  usColor;
 	BOOLEAN fBeginningOfNewString;
 	UINT32  uiTimeOfLastUpdate;
-	ScrollStringSt* pNext;
+};
+
+
+// A line of the tactical messages, wrapped and measured when it is added
+struct TacticalLine
+{
+	ST::utf32_buffer codepoints;
+	UINT16  usColor;
+	UINT16  usWidth;
+	BOOLEAN fBeginningOfNewString;
+	UINT32  uiTimeOfLastUpdate;
+	INT16   sY;
 };
 
 
 #define MAX_LINE_COUNT 6
+// Lines waiting to be shown in tactical, the oldest are dropped beyond that
+#define TACTICAL_QUEUE_SIZE 256
 #define X_START 2
 #define Y_START (SCREEN_HEIGHT - 150)
 #define MAX_AGE 10000
@@ -64,69 +79,84 @@ UINT8 gubCurrentMapMessageString = 0;
 BOOLEAN fOkToBeepNewMessage = TRUE;
 
 
-static ScrollStringSt* gpDisplayList[MAX_LINE_COUNT];
-static ScrollStringSt* gMapScreenMessageList[256];
-static ScrollStringSt* pStringS = NULL;
+// Shown tactical lines, the newest first, all drawn by one overlay
+static std::optional<TacticalLine> gDisplayList[MAX_LINE_COUNT];
+static VIDEO_OVERLAY* g_scroll_overlay = NULL;
+static BOOLEAN        g_scroll_overlay_enabled = TRUE;
 
-static BOOLEAN fScrollMessagesHidden = FALSE;
-static UINT32  uiStartOfPauseTime = 0;
+// Ring buffer of the tactical lines waiting to be shown
+static TacticalLine g_tactical_queue[TACTICAL_QUEUE_SIZE];
+static UINT32       g_tactical_queue_head  = 0;
+static UINT32       g_tactical_queue_count = 0;
 
+static std::optional<ScrollStringSt> gMapScreenMessageList[256];
 
-static ScrollStringSt* AddString(const ST::string& str, UINT16 usColor, BOOLEAN fStartOfNewString)
-{
-	ScrollStringSt* const i = new ScrollStringSt{};
-	i->pString = str;
-	i->video_overlay         = NULL;
-	i->usColor               = usColor;
-	i->fBeginningOfNewString = fStartOfNewString;
-	i->pNext                 = NULL;
-	return i;
-}
+static BOOLEAN fScrollMessagesHidden = FALSE;
+static UINT32  uiStartOfPauseTime = 0;
 
 
-static void RemoveStringVideoOverlay(ScrollStringSt* pStringSt)
+static void BlitScrollStrings(VIDEO_OVERLAY* const v)
 {
-	// error check, remove one not there
-	if (pStringSt->video_overlay == NULL) return;
-	RemoveVideoOverlay(pStringSt->video_overlay);
-	pStringSt->video_overlay = NULL;
-}
-
+	if (fScrollMessagesHidden) return;
 
-static void SetStringVideoOverlayPosition(ScrollStringSt* pStringSt, UINT16 usX, UINT16 usY)
-{
-	// Donot update if not allocated!
-	if (pStringSt->video_overlay == NULL) return;
-	SetVideoOverlayPos(pStringSt->video_overlay, usX, usY);
+	SGPVSurface::Lock l(v->uiDestBuff);
+	for (auto const& line : gDisplayList)
+	{
+		if (!line) continue;
+		SetFontAttributes(TINYFONT1, static_cast<UINT8>(line->usColor), DEFAULT_SHADOW, FONT_MCOLOR_BLACK);
+		MPrintBuffer(l.Buffer<UINT16>(), l.Pitch(), X_START, line->sY, line->codepoints);
+	}
 }
 
 
-static void BlitString(VIDEO_OVERLAY* pBlitter)
+// Fits the overlay around the shown lines, removes it if there are none
+static void UpdateScrollStringOverlay(void)
 {
-	if (fScrollMessagesHidden) return;
+	INT16  top    = SCREEN_HEIGHT;
+	INT16  bottom = 0;
+	UINT16 width  = 0;
+	for (auto const& line : gDisplayList)
+	{
+		if (!line) continue;
+		top    = std::min(top, line->sY);
+		bottom = std::max(bottom, static_cast<INT16>(line->sY + GetFontHeight(TINYFONT1)));
+		width  = std::max(width, line->usWidth);
+	}
 
-	SetFontAttributes(pBlitter->uiFontID, pBlitter->ubFontFore, DEFAULT_SHADOW, pBlitter->ubFontBack);
-	SGPVSurface::Lock l(pBlitter->uiDestBuff);
-	MPrintBuffer(l.Buffer<UINT16>(), l.Pitch(), pBlitter->sX, pBlitter->sY, pBlitter->codepoints);
+	if (width == 0 || bottom <= top)
+	{
+		RemoveVideoOverlay(g_scroll_overlay);
+		g_scroll_overlay = NULL;
+	}
+	else if (g_scroll_overlay)
+	{
+		// The lines are clipped away, register a new overlay once they are back
+		if (!SetVideoOverlayArea(g_scroll_overlay, X_START, top, width, bottom - top))
+		{
+			RemoveVideoOverlay(g_scroll_overlay);
+			g_scroll_overlay = NULL;
+		}
+	}
+	else
+	{
+		g_scroll_overlay = RegisterVideoOverlay(BlitScrollStrings, X_START, top, width, bottom - top);
+		EnableVideoOverlay(g_scroll_overlay_enabled, g_scroll_overlay);
+	}
 }
 
 
 // this function will go through list of display strings and clear them all out
 void ClearDisplayedListOfTacticalStrings(void)
 {
-	for (UINT32 cnt = 0; cnt < MAX_LINE_COUNT; cnt++)
+	for (auto& line : gDisplayList)
 	{
-		if (gpDisplayList[cnt] != NULL)
-		{
-			RemoveStringVideoOverlay(gpDisplayList[cnt]);
-			delete gpDisplayList[cnt];
-			gpDisplayList[cnt] = NULL;
-		}
+		line.reset();
 	}
+	RemoveVideoOverlay(g_scroll_overlay);
+	g_scroll_overlay = NULL;
 }
 
 
-static INT32 GetMessageQueueSize(void);
 static void PlayNewMessageSound(void);
 
 
@@ -149,10 +179,10 @@ void ScrollString(void)
 		return;
 	}
 
-	INT32 iNumberOfMessagesOnQueue = GetMessageQueueSize();
+	INT32 iNumberOfMessagesOnQueue = g_tactical_queue_count;
 	INT32 iMaxAge = MAX_AGE;
 
-	BOOLEAN fDitchLastMessage = (iNumberOfMessagesOnQueue > 0 && gpDisplayList[MAX_LINE_COUNT - 1] != NULL);
+	BOOLEAN fDitchLastMessage = (iNumberOfMessagesOnQueue > 0 && gDisplayList[MAX_LINE_COUNT - 1]);
 
 	if (iNumberOfMessagesOnQueue * 1000 >= iMaxAge)
 	{
@@ -164,20 +194,21 @@ void ScrollString(void)
 	}
 
 	//AGE
+	bool fLinesChanged = false;
 	for (UINT32 cnt = 0; cnt < MAX_LINE_COUNT; cnt++)
 	{
-		if (gpDisplayList[cnt] != NULL)
+		std::optional<TacticalLine>& line = gDisplayList[cnt];
+		if (line)
 		{
 			if (fDitchLastMessage && cnt == MAX_LINE_COUNT - 1)
 			{
-				gpDisplayList[cnt]->uiTimeOfLastUpdate = iMaxAge;
+				line->uiTimeOfLastUpdate = iMaxAge;
 			}
 				// CHECK IF WE HAVE AGED
-			if (suiTimer - gpDisplayList[cnt]->uiTimeOfLastUpdate > (UINT32)(iMaxAge - 1000 * iNumberOfMessagesOnQueue))
+			if (suiTimer - line->uiTimeOfLastUpdate > (UINT32)(iMaxAge - 1000 * iNumberOfMessagesOnQueue))
 			{
-				RemoveStringVideoOverlay(gpDisplayList[cnt]);
-				delete gpDisplayList[cnt];
-				gpDisplayList[cnt] = NULL;
+				line.reset();
+				fLinesChanged = true;
 			}
 		}
 	}
@@ -186,64 +217,55 @@ void ScrollString(void)
 	// CHECK FOR FREE SPOTS AND ADD ANY STRINGS IF WE HAVE SOME TO ADD!
 
 	// FIRST CHECK IF WE HAVE ANY IN OUR QUEUE
-	if (pStringS != NULL)
+	// CHECK IF WE HAVE A SLOT!
+	// CHECK OUR LAST SLOT!
+	if (g_tactical_queue_count != 0 && !gDisplayList[MAX_LINE_COUNT - 1])
 	{
-		// CHECK IF WE HAVE A SLOT!
-		// CHECK OUR LAST SLOT!
-		if (gpDisplayList[MAX_LINE_COUNT - 1] == NULL)
+		// MOVE ALL UP!
+		for (UINT32 cnt = MAX_LINE_COUNT - 1; cnt > 0; cnt--)
 		{
-			// MOVE ALL UP!
-
-			// cpy, then move
-			for (UINT32 cnt = MAX_LINE_COUNT - 1; cnt > 0; cnt--)
-			{
-				gpDisplayList[cnt] = gpDisplayList[cnt - 1];
-			}
-
-			INT32 iNumberOfNewStrings = 0; // the count of new strings, so we can update position by WIDTH_BETWEEN_NEW_STRINGS pixels in the y
+			gDisplayList[cnt] = std::move(gDisplayList[cnt - 1]);
+		}
 
-			// now add in the new string
-			gpDisplayList[0] = pStringS;
-			pStringS->video_overlay = RegisterVideoOverlay(BlitString, X_START, Y_START, TINYFONT1, pStringS->usColor, FONT_MCOLOR_BLACK, pStringS->pString);
-			if (pStringS->fBeginningOfNewString)
-			{
-				iNumberOfNewStrings++;
-			}
+		// now add in the new string
+		TacticalLine& next = g_tactical_queue[g_tactical_queue_head];
+		g_tactical_queue_head = (g_tactical_queue_head + 1) % TACTICAL_QUEUE_SIZE;
+		--g_tactical_queue_count;
+		gDisplayList[0] = std::move(next);
 
-			// set up age
-			pStringS->uiTimeOfLastUpdate = GetJA2Clock();
+		// set up age
+		gDisplayList[0]->uiTimeOfLastUpdate = GetJA2Clock();
 
-			// now move
-			for (UINT32 cnt = 0; cnt <= MAX_LINE_COUNT - 1; cnt++)
-			{
-				// Adjust position!
-				if (gpDisplayList[cnt] != NULL)
-				{
-					SetStringVideoOverlayPosition(gpDisplayList[cnt], X_START, Y_START - cnt * GetFontHeight(SMALLFONT1) - WIDTH_BETWEEN_NEW_STRINGS * iNumberOfNewStrings);
-
-					// start of new string, increment count of new strings, for spacing purposes
-					if (gpDisplayList[cnt]->fBeginningOfNewString)
-					{
-						iNumberOfNewStrings++;
-					}
-				}
-			}
+		// the count of new strings, so we can update position by WIDTH_BETWEEN_NEW_STRINGS pixels in the y
+		INT32 iNumberOfNewStrings = gDisplayList[0]->fBeginningOfNewString ? 1 : 0;
 
-			// WE NOW HAVE A FREE SPACE, INSERT!
+		// now move
+		for (UINT32 cnt = 0; cnt <= MAX_LINE_COUNT - 1; cnt++)
+		{
+			std::optional<TacticalLine>& line = gDisplayList[cnt];
+			if (!line) continue;
 
-			// Adjust head!
-			pStringS = pStringS->pNext;
+			line->sY = Y_START - cnt * GetFontHeight(SMALLFONT1) - WIDTH_BETWEEN_NEW_STRINGS * iNumberOfNewStrings;
 
-			//check if new meesage we have not seen since mapscreen..if so, beep
-			if (fOkToBeepNewMessage &&
-					gpDisplayList[MAX_LINE_COUNT - 2] == NULL &&
-					(guiCurrentScreen == GAME_SCREEN || guiCurrentScreen == MAP_SCREEN) &&
-					!gfFacePanelActive)
+			// start of new string, increment count of new strings, for spacing purposes
+			if (line->fBeginningOfNewString)
 			{
-				PlayNewMessageSound();
+				iNumberOfNewStrings++;
 			}
 		}
+		fLinesChanged = true;
+
+		//check if new meesage we have not seen since mapscreen..if so, beep
+		if (fOkToBeepNewMessage &&
+				!gDisplayList[MAX_LINE_COUNT - 2] &&
+				(guiCurrentScreen == GAME_SCREEN || guiCurrentScreen == MAP_SCREEN) &&
+				!gfFacePanelActive)
+		{
+			PlayNewMessageSound();
+		}
 	}
+
+	if (fLinesChanged) UpdateScrollStringOverlay();
 }
 
 
@@ -267,14 +289,10 @@ void HideMessagesDuringNPCDialogue(void)
 	fScrollMessagesHidden = TRUE;
 	uiStartOfPauseTime = GetJA2Clock();
 
-	for (INT32 cnt = 0; cnt < MAX_LINE_COUNT; cnt++)
+	if (g_scroll_overlay != NULL)
 	{
-		const ScrollStringSt* const s = gpDisplayList[cnt];
-		if (s != NULL)
-		{
-			RestoreExternBackgroundRectGivenID(s->video_overlay->background);
-			EnableVideoOverlay(FALSE, s->video_overlay);
-		}
+		RestoreExternBackgroundRectGivenID(g_scroll_overlay->background);
+		EnableVideoOverlay(FALSE, g_scroll_overlay);
 	}
 }
 
@@ -283,15 +301,11 @@ void UnHideMessagesDuringNPCDialogue(void)
 {
 	fScrollMessagesHidden = FALSE;
 
-	for (INT32 cnt = 0; cnt < MAX_LINE_COUNT; cnt++)
+	for (auto& line : gDisplayList)
 	{
-		ScrollStringSt* const s = gpDisplayList[cnt];
-		if (s != NULL)
-		{
-			s->uiTimeOfLastUpdate += GetJA2Clock() - uiStartOfPauseTime;
-			EnableVideoOverlay(TRUE, s->video_overlay);
-		}
+		if (line) line->uiTimeOfLastUpdate += GetJA2Clock() - uiStartOfPauseTime;
 	}
+	EnableVideoOverlay(TRUE, g_scroll_overlay);
 }
 
 
@@ -344,15 +358,24 @@ static void TacticalScreenMsg(UINT16 colour, UINT8 const priority, const ST::str
 
 	WRAPPED_STRING* const head = LineWrap(TINYFONT1, LINE_WIDTH, msg);
 
-	ScrollStringSt** anchor = &pStringS;
-	while (*anchor) anchor = &(*anchor)->pNext;
-
 	BOOLEAN new_string = TRUE;
 	for (WRAPPED_STRING* i = head; i; i = i->pNextWrappedString)
 	{
-		ScrollStringSt* const tmp = AddString(i->codepoints, colour, new_string);
-		*anchor    = tmp;
-		anchor     = &tmp->pNext;
+		// Drop the oldest waiting line if the queue is full
+		if (g_tactical_queue_count == TACTICAL_QUEUE_SIZE)
+		{
+			g_tactical_queue_head = (g_tactical_queue_head + 1) % TACTICAL_QUEUE_SIZE;
+			--g_tactical_queue_count;
+		}
+
+		TacticalLine& line = g_tactical_queue[(g_tactical_queue_head + g_tactical_queue_count) % TACTICAL_QUEUE_SIZE];
+		line.codepoints            = i->codepoints;
+		line.usColor               = colour;
+		line.usWidth               = StringPixLength(i->codepoints, TINYFONT1);
+		line.fBeginningOfNewString = new_string;
+		line.uiTimeOfLastUpdate    = 0;
+		line.sY                    = 0;
+		++g_tactical_queue_count;
 		new_string = FALSE;
 	}
 
@@ -413,23 +436,12 @@ void MapScreenMessage(UINT16 usColor, UINT8 ubPriority, const ST::string& str)
 // add string to the map screen message list
 static void AddStringToMapScreenMessageList(const ST::string& pString, UINT16 usColor, BOOLEAN fStartOfNewString)
 {
-	ScrollStringSt* const pStringSt = AddString(pString, usColor, fStartOfNewString);
-
 	// Figure out which queue slot index we're going to use to store this
 	// If queue isn't full, this is easy, if is is full, we'll re-use the oldest slot
 	// Must always keep the wraparound in mind, although this is easy enough with a static, fixed-size queue.
 
 	// always store the new message at the END index
-
-	// check if slot is being used, if so, clear it up
-	ScrollStringSt* const old = gMapScreenMessageList[gubEndOfMapScreenMessageList];
-	if (old != NULL)
-	{
-		delete old;
-	}
-
-	// store the new message there
-	gMapScreenMessageList[gubEndOfMapScreenMessageList] = pStringSt;
+	gMapScreenMessageList[gubEndOfMapScreenMessageList] = ScrollStringSt{ pString, usColor, fStartOfNewString, 0 };
 
 	// increment the end
 	gubEndOfMapScreenMessageList = (gubEndOfMapScreenMessageList + 1) % 256;
@@ -464,8 +476,8 @@ void DisplayStringsInMapScreenMessageList(void)
 			break;
 		}
 
-		const ScrollStringSt* const s = gMapScreenMessageList[ubCurrentStringIndex];
-		if (s == NULL) break;
+		std::optional<ScrollStringSt> const& s = gMapScreenMessageList[ubCurrentStringIndex];
+		if (!s) break;
 
 		SetFontForeground(s->usColor);
 		MPrint(STD_SCREEN_X + 20, sY, s->pString);
@@ -482,16 +494,10 @@ void DisplayStringsInMapScreenMessageList(void)
 
 void EnableDisableScrollStringVideoOverlay(BOOLEAN fEnable)
 {
-	/* will go through the list of video overlays for the tactical scroll message
-	 * system, and enable/disable video overlays depending on fEnable */
-	for (INT8 bCounter = 0; bCounter < MAX_LINE_COUNT; bCounter++)
-	{
-		const ScrollStringSt* const s = gpDisplayList[bCounter];
-		if (s != NULL)
-		{
-			EnableVideoOverlay(fEnable, s->video_overlay);
-		}
-	}
+	/* will enable/disable the video overlay of the tactical scroll message
+	 * system depending on fEnable */
+	g_scroll_overlay_enabled = fEnable;
+	EnableVideoOverlay(fEnable, g_scroll_overlay);
 }
 
 
@@ -511,13 +517,13 @@ static void PlayNewMessageSound(void)
 }
 
 
-static ScrollStringSt* ExtractScrollStringFromFile(HWFILE const f, bool stracLinuxFormat)
+static std::optional<ScrollStringSt> ExtractScrollStringFromFile(HWFILE const f, bool stracLinuxFormat)
 {
 	UINT32 size;
 	f->read(&size, sizeof(size));
-	if (size == 0) return 0;
+	if (size == 0) return std::nullopt;
 
-	SGP::PODObj<ScrollStringSt> s;
+	ScrollStringSt s{};
 	{
 		SGP::Buffer<uint8_t> data(size);
 		f->read(data, size);
@@ -525,12 +531,12 @@ static ScrollStringSt* ExtractScrollStringFromFile(HWFILE const f, bool stracLin
 		if(stracLinuxFormat)
 		{
 			size_t const len = size / 4;
-			s->pString = reader.readUTF32(len);
+			s.pString = reader.readUTF32(len);
 		}
 		else
 		{
 			size_t const len = size / 2;
-			s->pString = reader.readUTF16(len);
+			s.pString = reader.readUTF16(len);
 		}
 	}
 
@@ -539,18 +545,18 @@ static ScrollStringSt* ExtractScrollStringFromFile(HWFILE const f, bool stracLin
 
 	DataReader d{data};
 	EXTR_SKIP(d, 4)
-	EXTR_U32(d, s->uiTimeOfLastUpdate)
+	EXTR_U32(d, s.uiTimeOfLastUpdate)
 	EXTR_SKIP(d, 16)
-	EXTR_U16(d, s->usColor)
-	EXTR_BOOL(d, s->fBeginningOfNewString)
+	EXTR_U16(d, s.usColor)
+	EXTR_BOOL(d, s.fBeginningOfNewString)
 	EXTR_SKIP(d, 1)
 	Assert(d.getConsumed() == lengthof(data));
 
-	return s.Release();
+	return s;
 }
 
 
-static void InjectScrollStringIntoFile(HWFILE const f, ScrollStringSt const* const s)
+static void InjectScrollStringIntoFile(HWFILE const f, std::optional<ScrollStringSt> const& s)
 {
 	if(!s)
 	{
@@ -589,9 +595,9 @@ void SaveMapScreenMessagesToSaveGameFile(HWFILE const hFile)
 	hFile->write(&gubCurrentMapMessageString, sizeof(UINT8));
 
 	//Loopthrough all the messages
-	FOR_EACH(ScrollStringSt* const, i, gMapScreenMessageList)
+	for (auto const& s : gMapScreenMessageList)
 	{
-		InjectScrollStringIntoFile(hFile, *i);
+		InjectScrollStringIntoFile(hFile, s);
 	}
 }
 
@@ -615,17 +621,9 @@ void LoadMapScreenMessagesFromSaveGameFile(HWFILE const hFile, bool stracLinuxFo
 	hFile->read(&gubCurrentMapMessageString, sizeof(UINT8));
 
 	//Loopthrough all the messages
-	FOR_EACH(ScrollStringSt*, i, gMapScreenMessageList)
+	for (auto& s : gMapScreenMessageList)
 	{
-		ScrollStringSt* const s = ExtractScrollStringFromFile(hFile, stracLinuxFormat);
-
-		ScrollStringSt* const old = *i;
-		if (old)
-		{
-			delete old;
-		}
-
-		*i = s;
+		s = ExtractScrollStringFromFile(hFile, stracLinuxFormat);
 	}
 
 	// this will set a valid value for gubFirstMapscreenMessageIndex, which isn't being saved/restored
@@ -633,43 +631,25 @@ void LoadMapScreenMessagesFromSaveGameFile(HWFILE const hFile, bool stracLinuxFo
 }
 
 
-static INT32 GetMessageQueueSize(void)
-{
-	INT32 iCounter = 0;
-	for (const ScrollStringSt* i = pStringS; i != NULL; i = i->pNext)
-	{
-		iCounter++;
-	}
-	return iCounter;
-}
-
-
 void ClearTacticalMessageQueue(void)
 {
 	ClearDisplayedListOfTacticalStrings();
 
-	// now run through all the tactical messages
-	for (ScrollStringSt* i = pStringS; i != NULL;)
+	// now drop all the waiting tactical messages
+	for (UINT32 i = 0; i != g_tactical_queue_count; ++i)
 	{
-		ScrollStringSt* del = i;
-		i = i->pNext;
-		delete del;
+		g_tactical_queue[(g_tactical_queue_head + i) % TACTICAL_QUEUE_SIZE].codepoints = ST::utf32_buffer();
 	}
-
-	pStringS = NULL;
+	g_tactical_queue_head  = 0;
+	g_tactical_queue_count = 0;
 }
 
 
 void FreeGlobalMessageList(void)
 {
-	FOR_EACH(ScrollStringSt*, i, gMapScreenMessageList)
+	for (auto& s : gMapScreenMessageList)
 	{
-		ScrollStringSt* const s = *i;
-		if (s != NULL)
-		{
-			delete s;
-			*i = NULL;
-		}
+		s.reset();
 	}
 
 	gubEndOfMapScreenMessageList   = 0;
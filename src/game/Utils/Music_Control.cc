@@ -15,7 +15,19 @@
 #include "ContentManager.h"
 #include "GameInstance.h"
 
+#include <cstdint>
+
+// Duration of one fade step, the interval of the MUSICOVERHEAD timer
+#define MUSIC_FADE_STEP_TIME 10
+
 static UINT32  uiMusicHandle   = NO_SAMPLE;
+// Track of the new music mode, decoded in the background until it can take
+// over from the current one without a gap
+static UINT32  uiNextMusicHandle = NO_SAMPLE;
+// Every started track gets a number, so the end callbacks of tracks which
+// were crossfaded out or never started can be told apart
+static UINT32  guiMusicTrack     = 0;
+static UINT32  guiNextMusicTrack = 0;
 static UINT32  uiMusicVolume   = 50;
 static BOOLEAN fMusicPlaying   = FALSE;
 static BOOLEAN fMusicFadingOut = FALSE;
@@ -41,11 +53,25 @@ static void MusicStop(void);
 static void MusicStopCallback(void* pData);
 
 
+static void* MusicTrackData(UINT32 const track)
+{
+	return reinterpret_cast<void*>(static_cast<uintptr_t>(track));
+}
+
+
+static UINT32 NewMusicTrack(void)
+{
+	static UINT32 counter = 0;
+	return ++counter;
+}
+
+
 void MusicPlay(const ST::string* pFilename)
 {
 	MusicStop();
 
-	uiMusicHandle = SoundPlay(pFilename->c_str(), 0, 64, 1, MusicStopCallback, NULL);
+	guiMusicTrack = NewMusicTrack();
+	uiMusicHandle = SoundPlay(pFilename->c_str(), 0, 64, 1, MusicStopCallback, MusicTrackData(guiMusicTrack));
 
 	if(uiMusicHandle!=SOUND_ERROR)
 	{
@@ -109,10 +135,21 @@ UINT32 MusicGetVolume(void)
 }
 
 
+// Drops the prepared track of the next music mode, if any
+static void MusicDiscardNextTrack(void)
+{
+	if (uiNextMusicHandle == NO_SAMPLE) return;
+
+	SoundStop(uiNextMusicHandle);
+	uiNextMusicHandle = NO_SAMPLE;
+}
+
+
 //		Stops the currently playing music.
 static void MusicStop(void)
 {
 	SLOGD("Music Stop {} {} {}", fMusicPlaying, uiMusicHandle, gubMusicMode);
+	MusicDiscardNextTrack();
 	if(!fMusicPlaying)
 	{
 		return;
@@ -158,6 +195,9 @@ static BOOLEAN MusicFadeIn(void)
 	return(FALSE);
 }
 
+static void MusicCrossfade(void);
+
+
 void MusicPoll(void)
 {
 	INT32 iVol;
@@ -165,6 +205,11 @@ void MusicPoll(void)
 	SoundServiceStreams();
 	SoundServiceRandom();
 
+	if (uiNextMusicHandle != NO_SAMPLE && SoundIsPrepared(uiNextMusicHandle))
+	{
+		MusicCrossfade();
+	}
+
 	// Handle Sound every sound overhead time....
 	if ( COUNTERDONE( MUSICOVERHEAD )  )
 	{
@@ -221,7 +266,8 @@ void MusicPoll(void)
 			}
 			else
 			{
-				if ( !gfDontRestartSong )
+				// A prepared track of a new mode takes over by itself
+				if ( !gfDontRestartSong && uiNextMusicHandle == NO_SAMPLE )
 				{
 					StartMusicBasedOnMode( );
 				}
@@ -234,6 +280,9 @@ void MusicPoll(void)
 }
 
 
+static void MusicPrepareNextTrack(void);
+
+
 void SetMusicMode(MusicMode ubMusicMode)
 {
 	static MusicMode bPreviousMode = MUSIC_NONE;
@@ -268,8 +317,8 @@ void SetMusicMode(MusicMode ubMusicMode)
 
 		if(uiMusicHandle!=NO_SAMPLE  )
 		{
-			// Fade out old music
-			MusicFadeOut( );
+			// Crossfade to the new music once it is ready
+			MusicPrepareNextTrack( );
 		}
 		else
 		{
@@ -282,9 +331,9 @@ void SetMusicMode(MusicMode ubMusicMode)
 }
 
 
-static void StartMusicBasedOnMode(void)
+// Picks a track for the current music mode, NULL if the mode has no music
+static const ST::string* ChooseMusicForMode(void)
 {
-	SLOGD("StartMusicBasedOnMode() {} {}", uiMusicHandle, gubMusicMode);
 	MusicMode next = gubMusicMode;
 
 	switch (gubMusicMode) {
@@ -307,6 +356,27 @@ static void StartMusicBasedOnMode(void)
 			break;
 	}
 
+	switch (gubMusicMode) {
+		case MUSIC_MAIN_MENU:
+		case MUSIC_LAPTOP:
+		case MUSIC_TACTICAL_NOTHING:
+		case MUSIC_TACTICAL_ENEMYPRESENT:
+		case MUSIC_TACTICAL_BATTLE:
+		case MUSIC_TACTICAL_CREATURE_NOTHING:
+		case MUSIC_TACTICAL_CREATURE_ENEMYPRESENT:
+		case MUSIC_TACTICAL_CREATURE_BATTLE:
+		case MUSIC_TACTICAL_VICTORY:
+		case MUSIC_TACTICAL_DEFEAT:
+			return GCM->getMusicForMode(next);
+		default:
+			return NULL;
+	}
+}
+
+
+// Bookkeeping for a track of the current music mode starting to play
+static void CountMusicModeStart(void)
+{
 	switch (gubMusicMode) {
 		case MUSIC_TACTICAL_VICTORY:
 			gbVictorySongCount++;
@@ -321,30 +391,86 @@ static void StartMusicBasedOnMode(void)
 		default: // ignore other modes
 			break;
 	}
+}
 
-	switch (gubMusicMode) {
-		case MUSIC_MAIN_MENU:
-		case MUSIC_LAPTOP:
-		case MUSIC_TACTICAL_NOTHING:
-		case MUSIC_TACTICAL_ENEMYPRESENT:
-		case MUSIC_TACTICAL_BATTLE:
-		case MUSIC_TACTICAL_CREATURE_NOTHING:
-		case MUSIC_TACTICAL_CREATURE_ENEMYPRESENT:
-		case MUSIC_TACTICAL_CREATURE_BATTLE:
-		case MUSIC_TACTICAL_VICTORY:
-		case MUSIC_TACTICAL_DEFEAT:
-			// ATE: Don't fade in
-			gbFadeSpeed = (INT8)uiMusicVolume;
-			MusicPlay( GCM->getMusicForMode(next) );
-			break;
-		default:
-			MusicFadeOut();
+
+static void StartMusicBasedOnMode(void)
+{
+	SLOGD("StartMusicBasedOnMode() {} {}", uiMusicHandle, gubMusicMode);
+	const ST::string* const track = ChooseMusicForMode();
+
+	CountMusicModeStart();
+
+	if (track != NULL)
+	{
+		// ATE: Don't fade in
+		gbFadeSpeed = (INT8)uiMusicVolume;
+		MusicPlay(track);
+	}
+	else
+	{
+		MusicFadeOut();
 	}
 }
 
 
+/* Starts decoding a track for the current music mode while the old music
+ * keeps playing, MusicPoll() crossfades to it once enough is buffered. */
+static void MusicPrepareNextTrack(void)
+{
+	MusicDiscardNextTrack();
+
+	const ST::string* const track = ChooseMusicForMode();
+	if (track != NULL)
+	{
+		guiNextMusicTrack = NewMusicTrack();
+		uiNextMusicHandle = SoundPrepare(track->c_str(), 0, 64, 1, MusicStopCallback, MusicTrackData(guiNextMusicTrack));
+		if (uiNextMusicHandle != SOUND_ERROR)
+		{
+			SLOGD("Music Prepare {} {}", uiNextMusicHandle, gubMusicMode);
+			return;
+		}
+		SLOGE("Music Prepare Error {} {}", uiNextMusicHandle, gubMusicMode);
+		uiNextMusicHandle = NO_SAMPLE;
+	}
+
+	// No new music, or it could not be prepared: fade out and start over
+	// from StartMusicBasedOnMode() when the old music has ended
+	MusicFadeOut();
+}
+
+
+// Fades out the current music and fades in the prepared track in the mixer
+static void MusicCrossfade(void)
+{
+	// Same duration as the step wise fade out with the current fade speed
+	UINT32 const time = uiMusicVolume / std::max(gbFadeSpeed, INT8(1)) * MUSIC_FADE_STEP_TIME;
+
+	SLOGD("Music Crossfade {} -> {} {} ({}ms)", uiMusicHandle, uiNextMusicHandle, gubMusicMode, time);
+
+	if (uiMusicHandle != NO_SAMPLE) SoundFade(uiMusicHandle, 0, time, TRUE);
+
+	CountMusicModeStart();
+
+	uiMusicHandle     = uiNextMusicHandle;
+	guiMusicTrack     = guiNextMusicTrack;
+	uiNextMusicHandle = NO_SAMPLE;
+	SoundStartPrepared(uiMusicHandle);
+	SoundFade(uiMusicHandle, uiMusicVolume, time, FALSE);
+
+	gfMusicEnded    = FALSE;
+	fMusicPlaying   = TRUE;
+	fMusicFadingIn  = FALSE;
+	fMusicFadingOut = FALSE;
+	gbFadeSpeed     = 1;
+}
+
+
 static void MusicStopCallback(void* pData)
 {
+	// Tracks that were crossfaded out or discarded before they started
+	if (pData != MusicTrackData(guiMusicTrack)) return;
+
 	SLOGD("Music EndCallback {} {}", uiMusicHandle, gubMusicMode);
 
 	gfMusicEnded  = TRUE;
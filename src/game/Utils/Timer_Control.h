@@ -1,10 +1,27 @@
 #ifndef __TIMER_CONTROL_H
 #define __TIMER_CONTROL_H
 
+#include "Timer.h"
+
 #include <chrono>
 #include <cstdint>
 
-using ReferenceClock = std::chrono::steady_clock;
+// std::chrono::steady_clock, except that it follows GetClock() while a
+// session is recorded or replayed
+struct ReferenceClock
+{
+	using duration   = std::chrono::steady_clock::duration;
+	using rep        = duration::rep;
+	using period     = duration::period;
+	using time_point = std::chrono::time_point<ReferenceClock>;
+	static constexpr bool is_steady = true;
+
+	static time_point now() noexcept
+	{
+		if (gfGameClockFrozen) return time_point{ std::chrono::milliseconds{ guiFrozenClock } };
+		return time_point{ std::chrono::steady_clock::now().time_since_epoch() };
+	}
+};
 using TIMECOUNTER = std::chrono::time_point<ReferenceClock>;
 using std::chrono::milliseconds;
 using namespace std::chrono_literals;
@@ -12,6 +12,9 @@
 
 #include "policy/GamePolicy.h"
 
+#include <array>
+#include <map>
+#include <memory>
 #include <optional>
 
 
@@ -36,6 +39,11 @@ static UINT32 guiDelayTimer = 0;
 
 static MOUSEBLT_HOOK gMouseBltOverride = NULL;
 
+/* Composed cursors of the database, by cursor index followed by the shown
+ * sub index + 1 of every composite, 0 if it is not shown. */
+using CursorCacheKey = std::array<UINT32, MAX_COMPOSITES + 1>;
+static std::map<CursorCacheKey, std::unique_ptr<MouseCursorImage>> g_cursor_cache;
+
 std::optional<SGPPoint> gManualCursorPos = std::nullopt;
 
 void GetCursorPos(SGPPoint& point)
@@ -202,6 +210,8 @@ static void UnLoadCursorData(UINT32 uiCursorIndex)
 
 void CursorDatabaseClear(void)
 {
+	g_cursor_cache.clear();
+
 	for (UINT32 uiIndex = 0; uiIndex < gusNumDataFiles; uiIndex++)
 	{
 		CursorFileData* CFData = &gpCursorFileDatabase[uiIndex];
@@ -220,6 +230,7 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 
 	if (uiCursorIndex == VIDEO_NO_CURSOR)
 	{
+		HideSystemMouseCursor();
 		SetMouseCursorProperties(0, 0, 0, 0);
 	}
 	else if (gfCursorDatabaseInit)
@@ -228,6 +239,7 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 		if (uiCursorIndex == EXTERN_CURSOR)
 		{
 			// Erase old cursor
+			HideSystemMouseCursor();
 			EraseMouseCursor();
 
 			ETRLEObject const& pTrav       = guiExternVo->SubregionProperties(gusExternVoSubIndex);
@@ -249,6 +261,7 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 			if (pCurData->fHideOnTouch && IsUsingTouch()) {
 				uiCursorIndex = VIDEO_NO_CURSOR;
 				guiOldSetCursor = VIDEO_NO_CURSOR;
+				HideSystemMouseCursor();
 				SetMouseCursorProperties(0, 0, 0, 0);
 				return TRUE;
 			}
@@ -270,6 +283,7 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 			{
 				if (GetClock() - guiDelayTimer < 1000)
 				{
+					HideSystemMouseCursor();
 					SetMouseCursorProperties(0, 0, 0, 0);
 					return TRUE;
 				}
@@ -278,11 +292,10 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 			// Call LoadCursorData to make sure that the video object is loaded
 			LoadCursorData(uiCursorIndex);
 
-			// Erase old cursor
-			EraseMouseCursor();
 			// NOW ACCOMODATE COMPOSITE CURSORS
 			pCurData = &gpCursorDatabase[uiCursorIndex];
 
+			CursorCacheKey key{ uiCursorIndex };
 			for (UINT32 cnt = 0; cnt < pCurData->usNumComposites; cnt++)
 			{
 				// Check if we are a flashing cursor!
@@ -315,21 +328,30 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 				}
 
 				const CursorImage* pCurImage = &pCurData->Composites[cnt];
-				CursorFileData*    CFData    = &gpCursorFileDatabase[pCurImage->uiFileIndex];
+				if (pCurImage->usPosX == HIDE_SUBCURSOR || pCurImage->usPosY == HIDE_SUBCURSOR) continue;
 
 				// Adjust sub-index if cursor is animated
-				UINT16 usSubIndex;
-				if (CFData->ubNumberOfFrames != 0)
-				{
-					usSubIndex = pCurImage->uiCurrentFrame;
-				}
-				else
-				{
-					usSubIndex = pCurImage->uiSubIndex;
-				}
+				CursorFileData const* CFData = &gpCursorFileDatabase[pCurImage->uiFileIndex];
+				key[cnt + 1] = (CFData->ubNumberOfFrames != 0 ? pCurImage->uiCurrentFrame : pCurImage->uiSubIndex) + 1;
+			}
 
-				if (pCurImage->usPosX != HIDE_SUBCURSOR && pCurImage->usPosY != HIDE_SUBCURSOR)
+			std::unique_ptr<MouseCursorImage>& image = g_cursor_cache[key];
+			if (image)
+			{
+				RestoreMouseCursorImage(*image);
+			}
+			else
+			{
+				// Compose the cursor once
+				EraseMouseCursor();
+				for (UINT32 cnt = 0; cnt < pCurData->usNumComposites; cnt++)
 				{
+					if (key[cnt + 1] == 0) continue;
+
+					const CursorImage* pCurImage = &pCurData->Composites[cnt];
+					CursorFileData*    CFData    = &gpCursorFileDatabase[pCurImage->uiFileIndex];
+					UINT16      const  usSubIndex = key[cnt + 1] - 1;
+
 					// Blit cursor at position in mouse buffer
 					if (CFData->ubFlags & USE_OUTLINE_BLITTER)
 					{
@@ -340,14 +362,22 @@ BOOLEAN SetCurrentCursorFromDatabase(UINT32 uiCursorIndex)
 						BltToMouseCursorFromVObject(CFData->hVObject, usSubIndex, pCurImage->usPosX, pCurImage->usPosY);
 					}
 				}
+				image = SaveMouseCursorImage(pCurData->usWidth, pCurData->usHeight);
 			}
 
 			// Hook into hook function
-			if (gMouseBltOverride != NULL) gMouseBltOverride();
+			bool const drew_on_cursor = gMouseBltOverride != NULL && gMouseBltOverride();
 
 			INT16 sCenterValX = pCurData->sOffsetX;
 			INT16 sCenterValY = pCurData->sOffsetY;
 			SetMouseCursorProperties(sCenterValX, sCenterValY + gsGlobalCursorYOffset, pCurData->usHeight, pCurData->usWidth);
+
+			// Whatever the hook draws changes too often for system cursors
+			if (drew_on_cursor || gManualCursorPos ||
+				!ShowSystemMouseCursor(*image, sCenterValX, sCenterValY + gsGlobalCursorYOffset))
+			{
+				HideSystemMouseCursor();
+			}
 		}
 	}
 
@@ -375,6 +405,11 @@ void SetExternVOData(UINT32 uiCursorIndex, HVOBJECT hVObject, UINT16 usSubIndex)
 		{
 			// OK, set Video Object here....
 
+			// Forget the cursor as composed from the old one
+			CursorCacheKey const first{ uiCursorIndex };
+			CursorCacheKey const last{ uiCursorIndex + 1 };
+			g_cursor_cache.erase(g_cursor_cache.lower_bound(first), g_cursor_cache.lower_bound(last));
+
 			// If loaded, unload...
 			UnLoadCursorData(uiCursorIndex);
 
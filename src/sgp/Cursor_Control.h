@@ -78,7 +78,8 @@ void ClearManualCursorPos();
 
 void SetExternMouseCursor(SGPVObject const&, UINT16 region_idx);
 
-typedef void (*MOUSEBLT_HOOK)(void);
+// Draws on the composed cursor, returns whether it drew anything
+typedef bool (*MOUSEBLT_HOOK)(void);
 
 void InitCursorDatabase(CursorFileData* pCursorFileData, CursorData* pCursorData, UINT16 suNumDataFiles);
 void SetMouseBltHook(MOUSEBLT_HOOK pMouseBltOverride);
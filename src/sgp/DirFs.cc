@@ -10,14 +10,17 @@ ST::string DirFs::absolutePath(const ST::string &path) {
 }
 
 SGPFile *DirFs::openForWriting(const ST::string &path, bool truncate) {
+    fileChanged(path);
     return FileMan::openForWriting(absolutePath(path), truncate);
 }
 
 SGPFile *DirFs::openForAppend(const ST::string &path) {
+    fileChanged(path);
     return FileMan::openForAppend(absolutePath(path));
 }
 
 SGPFile *DirFs::openForReadWrite(const ST::string &path) {
+    fileChanged(path);
     return FileMan::openForReadWrite(absolutePath(path));
 }
 
@@ -26,6 +29,7 @@ SGPFile *DirFs::openForReading(const ST::string &path) {
 }
 
 void DirFs::deleteFile(const ST::string &path) {
+    fileChanged(path);
     return FileMan::deleteFile(absolutePath(path));
 }
 
@@ -34,6 +38,9 @@ void DirFs::createDir(const ST::string &path) {
 }
 
 void DirFs::eraseDir(const ST::string &path) {
+    // Conservatively count every file as changed, not only those in path
+    m_changeStamps.clear();
+    m_eraseStamp = ++m_lastChangeStamp;
     return FileMan::eraseDir(absolutePath(path));
 }
 
@@ -73,6 +80,8 @@ bool DirFs::exists(const ST::string &path) {
 }
 
 void DirFs::moveFile(const ST::string &from, const ST::string &to) {
+    fileChanged(from);
+    fileChanged(to);
     return FileMan::moveFile(absolutePath(from), absolutePath(to));
 }
 
@@ -83,3 +92,12 @@ double DirFs::getLastModifiedTime(const ST::string &path) {
 uint64_t DirFs::getFreeSpace(const ST::string& path) {
     return FileMan::getFreeSpace(absolutePath(path));
 }
+
+void DirFs::fileChanged(const ST::string &path) {
+    m_changeStamps[path.to_lower()] = ++m_lastChangeStamp;
+}
+
+uint64_t DirFs::getChangeStamp(const ST::string &path) const {
+    auto const it = m_changeStamps.find(path.to_lower());
+    return it != m_changeStamps.end() ? it->second : m_eraseStamp;
+}
@@ -4,6 +4,8 @@
 
 #include <string_theory/string>
 
+#include <map>
+
 
 /** Provides oprations for files within a subdirectory.
  *  Should be kept in sync with FileMan namespace to provide the same interface.
@@ -12,6 +14,13 @@ class DirFs
 {
 private:
 	ST::string m_basePath;
+	/* Change stamps of the files that were opened for changing, deleted or
+	 * moved, by lower case path, and the stamp of the last eraseDir(). */
+	std::map<ST::string, uint64_t> m_changeStamps;
+	uint64_t m_lastChangeStamp = 0;
+	uint64_t m_eraseStamp = 0;
+
+	void fileChanged(const ST::string &path);
 public:
 	/** Create a DirFs with base path */
 	DirFs(const ST::string& path) : m_basePath(path) {};
@@ -112,4 +121,8 @@ public:
 
 	/** Gets the amount of free space on the harddrive in a directory */
 	uint64_t getFreeSpace(const ST::string& path);
+
+	/** Stamp that changes whenever the file at path may have been changed
+	 * through this DirFs, for callers that keep the content of a file. */
+	uint64_t getChangeStamp(const ST::string &path) const;
 };
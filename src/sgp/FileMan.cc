@@ -165,10 +165,11 @@ FileMan::findFilesInDir(const ST::string& dirPath,
 	for (ST::string& path : paths)
 	{
 		// the extension must match
-		RustPointer<char> path_ext(Path_extension(path.c_str()));
-		if (path_ext)
+		RStrView path_ext{Path_extensionView(toRStrView(path))};
+		if (path_ext.data)
 		{
-			int cmp = caseInsensitive ? ext.compare_i(path_ext.get()) : ext.compare(path_ext.get());
+			ST::string const found_ext{fromRStrView(path_ext)};
+			int cmp = caseInsensitive ? ext.compare_i(found_ext) : ext.compare(found_ext);
 			if (cmp != 0)
 			{
 				continue;
@@ -181,9 +182,9 @@ FileMan::findFilesInDir(const ST::string& dirPath,
 		// keep filename or path
 		if (returnOnlyNames && !recursive)
 		{
-			RustPointer<char> filename{Path_filename(path.c_str())};
-			Assert(filename);
-			results.emplace_back(filename.get());
+			RStrView filename{Path_filenameView(toRStrView(path))};
+			Assert(filename.data);
+			results.emplace_back(fromRStrView(filename));
 		}
 		else
 		{
@@ -211,12 +212,12 @@ FileMan::findAllFilesInDir(const ST::string& dirPath, bool sortResults, bool rec
 	size_t len = VecCString_len(vec.get());
 	for (size_t i = 0; i < len; i++)
 	{
-		RustPointer<char> path{VecCString_get(vec.get(), i)};
+		// both views borrow from vec, nothing is copied until the result is stored
+		RStrView path{VecCString_getView(vec.get(), i)};
 		if (returnOnlyNames) {
-			RustPointer<char> filename{Path_filename(path.get())};
-			paths.emplace_back(filename.get());
+			paths.emplace_back(fromRStrView(Path_filenameView(path)));
 		} else {
-			paths.emplace_back(path.get());
+			paths.emplace_back(fromRStrView(path));
 		}
 	}
 	return paths;
@@ -236,12 +237,11 @@ FileMan::findAllDirsInDir(const ST::string& dirPath, bool sortResults, bool recu
 	size_t len = VecCString_len(vec.get());
 	for (size_t i = 0; i < len; i++)
 	{
-		RustPointer<char> path{VecCString_get(vec.get(), i)};
+		RStrView path{VecCString_getView(vec.get(), i)};
 		if (returnOnlyNames) {
-			RustPointer<char> filename{Path_filename(path.get())};
-			paths.emplace_back(filename.get());
+			paths.emplace_back(fromRStrView(Path_filenameView(path)));
 		} else {
-			paths.emplace_back(path.get());
+			paths.emplace_back(fromRStrView(path));
 		}
 	}
 	return paths;
@@ -276,18 +276,12 @@ ST::string FileMan::getParentPath(const ST::string &path, bool absolute)
 /** Get filename from the path. */
 ST::string FileMan::getFileName(const ST::string &path)
 {
-	RustPointer<char> filename(Path_filename(path.c_str()));
-	if (!filename)
-	{
-		return ST::string();
-	}
-	return ST::string(filename.get());
+	return fromRStrView(Path_filenameView(toRStrView(path)));
 }
 
 ST::string FileMan::getFileNameWithoutExt(const ST::string& path)
 {
-	RustPointer<char> filestem{Path_filestem(path.c_str())};
-	return filestem ? ST::string(filestem.get()) : ST::string();
+	return fromRStrView(Path_filestemView(toRStrView(path)));
 }
 
 bool FileMan::isFile(const ST::string& path) {
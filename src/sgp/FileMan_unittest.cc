@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "DirFs.h"
 #include "FileMan.h"
 
 #include "externalized/TestUtils.h"
@@ -233,3 +234,28 @@ TEST(FileManTest, FreeSpace)
 	ASSERT_NE(tempPath.get(), nullptr);
 	EXPECT_NE(FileMan::getFreeSpace(tempPath.get()), 0u);
 }
+
+TEST(FileManTest, DirFsChangeStamps)
+{
+	RustPointer<TempDir> tempDir(TempDir_create());
+	ASSERT_NE(tempDir.get(), nullptr);
+	RustPointer<char> tempPath(TempDir_path(tempDir.get()));
+	ASSERT_NE(tempPath.get(), nullptr);
+	DirFs dir(tempPath.get());
+
+	uint64_t const initial = dir.getChangeStamp("foo.txt");
+	delete dir.openForWriting("foo.txt");
+	uint64_t const written = dir.getChangeStamp("foo.txt");
+	EXPECT_NE(written, initial);
+	EXPECT_EQ(dir.getChangeStamp("FOO.txt"), written);
+	EXPECT_EQ(dir.getChangeStamp("bar.txt"), initial);
+
+	delete dir.openForReading("foo.txt");
+	EXPECT_EQ(dir.getChangeStamp("foo.txt"), written);
+
+	delete dir.openForAppend("foo.txt");
+	EXPECT_NE(dir.getChangeStamp("foo.txt"), written);
+
+	dir.eraseDir("");
+	EXPECT_NE(dir.getChangeStamp("bar.txt"), initial);
+}
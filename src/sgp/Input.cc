@@ -1,5 +1,6 @@
 #include "Types.h"
 #include "Input.h"
+#include "InputReplay.h"
 #include "English.h"
 #include "Timer.h"
 #include "Video.h"
@@ -186,13 +187,13 @@ void MouseButtonDown(const SDL_MouseButtonEvent* BtnEv)
 #if defined WITH_MAEMO
 			/* If the menu button (mapped to F4) is pressed, then treat the event as
 			 * right click */
-			const Uint8* const key_state = SDL_GetKeyboardState(NULL);
-			g_down_right = key_state[SDL_SCANCODE_F4];
+			g_down_right = InputReplay::IsKeyPressed(SDL_SCANCODE_F4);
 			if (g_down_right) goto right_button;
 #endif
 #if defined(__APPLE__)
-			const Uint8* const key_state = SDL_GetKeyboardState(NULL);
-			g_down_right = key_state[SDL_SCANCODE_LGUI] || key_state[SDL_SCANCODE_RGUI];
+			g_down_right =
+				InputReplay::IsKeyPressed(SDL_SCANCODE_LGUI) ||
+				InputReplay::IsKeyPressed(SDL_SCANCODE_RGUI);
 			if (g_down_right) goto right_button;
 #endif
 			gLeftButtonState.handleDown();
@@ -0,0 +1,495 @@
+#include "InputReplay.h"
+
+#include "FileMan.h"
+#include "Logger.h"
+#include "SGPFile.h"
+#include "Timer.h"
+
+#include <string_theory/format>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+
+bool   gfGameClockFrozen = false;
+UINT32 guiFrozenClock    = 0;
+
+
+namespace InputReplay
+{
+
+static char const  RECORDING_MAGIC[4] = { 'J', 'A', '2', 'R' };
+static UINT8 const RECORDING_VERSION  = 2;
+
+// Recorded data is written to the file in chunks of about this size
+static size_t const RECORDING_CHUNK = 16 * 1024;
+
+enum RecordType : UINT8
+{
+	RECORD_GAME_LOOP,
+	RECORD_KEY_DOWN,
+	RECORD_KEY_UP,
+	RECORD_TEXT_INPUT,
+	RECORD_MOUSE_BUTTON_DOWN,
+	RECORD_MOUSE_BUTTON_UP,
+	RECORD_MOUSE_MOTION,
+	RECORD_MOUSE_WHEEL,
+	RECORD_FINGER_MOTION,
+	RECORD_FINGER_DOWN,
+	RECORD_FINGER_UP,
+	RECORD_APP_BACKGROUND,
+	RECORD_APP_FOREGROUND,
+	RECORD_QUIT,
+	RECORD_CLOCK,
+	RECORD_KEY_STATE
+};
+
+enum class Mode { Off, Record, Replay };
+
+struct FileDeleter
+{
+	void operator()(SGPFile* const f) const { DeleteSGPFile(f); }
+};
+
+static Mode                                 gMode = Mode::Off;
+static ST::string                           gPath;
+static std::unique_ptr<SGPFile, FileDeleter> gFile;     // only while recording
+static std::vector<UINT8>                   gData;     // recorded but not written yet, or the whole replay
+static size_t                               gReadPos;
+static UINT32                               guiNextClock;
+static UINT32                               guiGameLoops;
+static std::chrono::steady_clock::time_point gStartTime;
+
+
+// Numbers are stored as LEB128, signed ones zigzag encoded first
+static void PutByte(UINT8 const b)
+{
+	gData.push_back(b);
+}
+
+
+static void PutUInt(UINT64 v)
+{
+	while (v >= 0x80)
+	{
+		PutByte(static_cast<UINT8>(v | 0x80));
+		v >>= 7;
+	}
+	PutByte(static_cast<UINT8>(v));
+}
+
+
+static void PutInt(INT64 const v)
+{
+	PutUInt((static_cast<UINT64>(v) << 1) ^ static_cast<UINT64>(v >> 63));
+}
+
+
+static void PutFloat(float const f)
+{
+	UINT32 u;
+	std::memcpy(&u, &f, sizeof(u));
+	PutUInt(u);
+}
+
+
+static UINT8 GetByte()
+{
+	if (gReadPos == gData.size()) throw std::runtime_error("recording is truncated");
+	return gData[gReadPos++];
+}
+
+
+static UINT64 GetUInt()
+{
+	UINT64 v = 0;
+	for (unsigned shift = 0; shift < 64; shift += 7)
+	{
+		UINT8 const b = GetByte();
+		v |= static_cast<UINT64>(b & 0x7F) << shift;
+		if (!(b & 0x80)) return v;
+	}
+	throw std::runtime_error("recording is corrupt");
+}
+
+
+static INT64 GetInt()
+{
+	UINT64 const u = GetUInt();
+	return static_cast<INT64>(u >> 1) ^ -static_cast<INT64>(u & 1);
+}
+
+
+static float GetFloat()
+{
+	UINT32 const u = static_cast<UINT32>(GetUInt());
+	float f;
+	std::memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+
+static void Flush()
+{
+	if (!gFile || gData.empty()) return;
+	gFile->write(gData.data(), gData.size());
+	gData.clear();
+}
+
+
+// Only the fields the input handlers look at are recorded
+static void WriteEvent(SDL_Event const& e)
+{
+	switch (e.type)
+	{
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			PutByte(e.type == SDL_KEYDOWN ? RECORD_KEY_DOWN : RECORD_KEY_UP);
+			PutInt(e.key.keysym.sym);
+			PutUInt(e.key.keysym.scancode);
+			PutUInt(e.key.keysym.mod);
+			PutByte(e.key.repeat);
+			break;
+
+		case SDL_TEXTINPUT:
+		{
+			size_t const len = strnlen(e.text.text, sizeof(e.text.text) - 1);
+			PutByte(RECORD_TEXT_INPUT);
+			PutUInt(len);
+			gData.insert(gData.end(), e.text.text, e.text.text + len);
+			break;
+		}
+
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+			PutByte(e.type == SDL_MOUSEBUTTONDOWN ? RECORD_MOUSE_BUTTON_DOWN : RECORD_MOUSE_BUTTON_UP);
+			PutByte(e.button.which == SDL_TOUCH_MOUSEID);
+			PutByte(e.button.button);
+			PutByte(e.button.clicks);
+			PutInt(e.button.x);
+			PutInt(e.button.y);
+			break;
+
+		case SDL_MOUSEMOTION:
+			PutByte(RECORD_MOUSE_MOTION);
+			PutByte(e.motion.which == SDL_TOUCH_MOUSEID);
+			PutInt(e.motion.x);
+			PutInt(e.motion.y);
+			break;
+
+		case SDL_MOUSEWHEEL:
+			PutByte(RECORD_MOUSE_WHEEL);
+			PutInt(e.wheel.x);
+			PutInt(e.wheel.y);
+			break;
+
+		case SDL_FINGERMOTION:
+		case SDL_FINGERDOWN:
+		case SDL_FINGERUP:
+			PutByte(
+				e.type == SDL_FINGERMOTION ? RECORD_FINGER_MOTION :
+				e.type == SDL_FINGERDOWN   ? RECORD_FINGER_DOWN   :
+				RECORD_FINGER_UP);
+			PutInt(e.tfinger.touchId);
+			PutInt(e.tfinger.fingerId);
+			PutFloat(e.tfinger.x);
+			PutFloat(e.tfinger.y);
+			break;
+
+		case SDL_APP_WILLENTERBACKGROUND: PutByte(RECORD_APP_BACKGROUND); break;
+		case SDL_APP_WILLENTERFOREGROUND: PutByte(RECORD_APP_FOREGROUND); break;
+		case SDL_QUIT:                    PutByte(RECORD_QUIT);           break;
+
+		default: break; // Window events do not change the game
+	}
+}
+
+
+// Returns false if the record was a game loop instead of an event
+static bool ReadEvent(SDL_Event& e)
+{
+	e = SDL_Event{};
+	switch (GetByte())
+	{
+		case RECORD_GAME_LOOP:
+			guiNextClock = guiFrozenClock + static_cast<UINT32>(GetUInt());
+			return false;
+
+		case RECORD_KEY_DOWN:
+		case RECORD_KEY_UP:
+			e.type = gData[gReadPos - 1] == RECORD_KEY_DOWN ? SDL_KEYDOWN : SDL_KEYUP;
+			e.key.state           = e.type == SDL_KEYDOWN ? SDL_PRESSED : SDL_RELEASED;
+			e.key.keysym.sym      = static_cast<SDL_Keycode>(GetInt());
+			e.key.keysym.scancode = static_cast<SDL_Scancode>(GetUInt());
+			e.key.keysym.mod      = static_cast<Uint16>(GetUInt());
+			e.key.repeat          = GetByte();
+			break;
+
+		case RECORD_TEXT_INPUT:
+		{
+			e.type = SDL_TEXTINPUT;
+			size_t const len = GetUInt();
+			if (len >= sizeof(e.text.text)) throw std::runtime_error("recording is corrupt");
+			for (size_t i = 0; i != len; ++i) e.text.text[i] = static_cast<char>(GetByte());
+			break;
+		}
+
+		case RECORD_MOUSE_BUTTON_DOWN:
+		case RECORD_MOUSE_BUTTON_UP:
+			e.type = gData[gReadPos - 1] == RECORD_MOUSE_BUTTON_DOWN ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+			e.button.state  = e.type == SDL_MOUSEBUTTONDOWN ? SDL_PRESSED : SDL_RELEASED;
+			e.button.which  = GetByte() ? SDL_TOUCH_MOUSEID : 0;
+			e.button.button = GetByte();
+			e.button.clicks = GetByte();
+			e.button.x      = static_cast<Sint32>(GetInt());
+			e.button.y      = static_cast<Sint32>(GetInt());
+			break;
+
+		case RECORD_MOUSE_MOTION:
+			e.type = SDL_MOUSEMOTION;
+			e.motion.which = GetByte() ? SDL_TOUCH_MOUSEID : 0;
+			e.motion.x     = static_cast<Sint32>(GetInt());
+			e.motion.y     = static_cast<Sint32>(GetInt());
+			break;
+
+		case RECORD_MOUSE_WHEEL:
+			e.type = SDL_MOUSEWHEEL;
+			e.wheel.x = static_cast<Sint32>(GetInt());
+			e.wheel.y = static_cast<Sint32>(GetInt());
+			break;
+
+		case RECORD_FINGER_MOTION:
+		case RECORD_FINGER_DOWN:
+		case RECORD_FINGER_UP:
+		{
+			UINT8 const type = gData[gReadPos - 1];
+			e.type =
+				type == RECORD_FINGER_MOTION ? SDL_FINGERMOTION :
+				type == RECORD_FINGER_DOWN   ? SDL_FINGERDOWN   :
+				SDL_FINGERUP;
+			e.tfinger.touchId  = GetInt();
+			e.tfinger.fingerId = GetInt();
+			e.tfinger.x        = GetFloat();
+			e.tfinger.y        = GetFloat();
+			break;
+		}
+
+		case RECORD_APP_BACKGROUND: e.type = SDL_APP_WILLENTERBACKGROUND; break;
+		case RECORD_APP_FOREGROUND: e.type = SDL_APP_WILLENTERFOREGROUND; break;
+		case RECORD_QUIT:           e.type = SDL_QUIT;                    break;
+
+		default: throw std::runtime_error("recording is corrupt");
+	}
+	return true;
+}
+
+
+// Reads a record which is taken in the middle of a game loop
+static void ExpectRecord(RecordType const type)
+{
+	if (GetByte() != type) throw std::runtime_error("recording is out of sync with the game");
+}
+
+
+static void FinishReplay()
+{
+	auto const elapsed = std::chrono::steady_clock::now() - gStartTime;
+	auto const us      = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+	SLOGI("Replayed {} game loops of '{}' in {} ms, {} us per game loop",
+		guiGameLoops, gPath, us / 1000, guiGameLoops != 0 ? us / guiGameLoops : 0);
+	gMode = Mode::Off;
+	gData.clear();
+}
+
+
+void StartRecording(const ST::string& path)
+{
+	gFile.reset(FileMan::openForWriting(path));
+	gPath = path;
+	gMode = Mode::Record;
+	gData.assign(std::begin(RECORDING_MAGIC), std::end(RECORDING_MAGIC));
+	PutByte(RECORDING_VERSION);
+	SLOGI("Recording the session to '{}'", path);
+}
+
+
+void StartReplay(const ST::string& path)
+{
+	{
+		AutoSGPFile f(FileMan::openForReading(path));
+		gData = f->readToEnd();
+	}
+	gReadPos = 0;
+	for (char const c : RECORDING_MAGIC)
+	{
+		if (GetByte() != static_cast<UINT8>(c)) throw std::runtime_error(ST::format("'{}' is not a recording", path).to_std_string());
+	}
+	if (GetByte() != RECORDING_VERSION)
+	{
+		throw std::runtime_error(ST::format("'{}' was recorded by another version of the game", path).to_std_string());
+	}
+	gPath = path;
+	gMode = Mode::Replay;
+	SLOGI("Replaying the session from '{}'", path);
+}
+
+
+void Stop()
+{
+	if (gMode != Mode::Record) return;
+	Flush();
+	gFile.reset();
+	gMode = Mode::Off;
+	SLOGI("Recorded {} game loops to '{}'", guiGameLoops, gPath);
+}
+
+
+bool IsRecording()
+{
+	return gMode == Mode::Record;
+}
+
+
+bool IsReplaying()
+{
+	return gMode == Mode::Replay;
+}
+
+
+RandomSeed TakeRandomSeed(RandomSeed const& fresh)
+{
+	switch (gMode)
+	{
+		case Mode::Record:
+			PutUInt(fresh.uiTime);
+			PutUInt(fresh.uiEntropy);
+			guiFrozenClock = SDL_GetTicks();
+			gfGameClockFrozen = true;
+			PutUInt(guiFrozenClock);
+			return fresh;
+
+		case Mode::Replay:
+		{
+			RandomSeed seed;
+			seed.uiTime       = static_cast<UINT32>(GetUInt());
+			seed.uiEntropy    = static_cast<UINT32>(GetUInt());
+			guiFrozenClock    = static_cast<UINT32>(GetUInt());
+			gfGameClockFrozen = true;
+			gStartTime        = std::chrono::steady_clock::now();
+			return seed;
+		}
+
+		default:
+			return fresh;
+	}
+}
+
+
+bool PollEvent(SDL_Event& event)
+{
+	switch (gMode)
+	{
+		case Mode::Record:
+			if (!SDL_PollEvent(&event)) return false;
+			WriteEvent(event);
+			return true;
+
+		case Mode::Replay:
+			// Keep the window responsive, but only closing it has an effect
+			while (SDL_PollEvent(&event))
+			{
+				if (event.type == SDL_QUIT) return true;
+			}
+			if (gReadPos == gData.size())
+			{
+				FinishReplay();
+				event = SDL_Event{};
+				event.type = SDL_QUIT;
+				return true;
+			}
+			return ReadEvent(event);
+
+		default:
+			return SDL_PollEvent(&event);
+	}
+}
+
+
+void BeginGameLoop()
+{
+	switch (gMode)
+	{
+		case Mode::Record:
+		{
+			UINT32 const now = SDL_GetTicks();
+			PutByte(RECORD_GAME_LOOP);
+			PutUInt(now - guiFrozenClock);
+			guiFrozenClock = now;
+			++guiGameLoops;
+			if (gData.size() >= RECORDING_CHUNK) Flush();
+			break;
+		}
+
+		case Mode::Replay:
+			guiFrozenClock = guiNextClock;
+			++guiGameLoops;
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+void AdvanceClock()
+{
+	// Before the seed is taken nothing is recorded yet
+	if (!gfGameClockFrozen) return;
+
+	switch (gMode)
+	{
+		case Mode::Record:
+		{
+			UINT32 const now = SDL_GetTicks();
+			PutByte(RECORD_CLOCK);
+			PutUInt(now - guiFrozenClock);
+			guiFrozenClock = now;
+			break;
+		}
+
+		case Mode::Replay:
+			ExpectRecord(RECORD_CLOCK);
+			guiFrozenClock += static_cast<UINT32>(GetUInt());
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+bool IsKeyPressed(SDL_Scancode const key)
+{
+	switch (gMode)
+	{
+		case Mode::Record:
+		{
+			bool const pressed = SDL_GetKeyboardState(NULL)[key] != 0;
+			PutByte(RECORD_KEY_STATE);
+			PutByte(pressed);
+			return pressed;
+		}
+
+		case Mode::Replay:
+			ExpectRecord(RECORD_KEY_STATE);
+			return GetByte() != 0;
+
+		default:
+			return SDL_GetKeyboardState(NULL)[key] != 0;
+	}
+}
+
+}
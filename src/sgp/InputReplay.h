@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Random.h"
+#include "Types.h"
+
+#include <SDL_events.h>
+#include <string_theory/string>
+
+
+/* Recording and replaying of play sessions
+ *
+ * A recording holds the random seed, every input event the main loop handled
+ * and the clock of every game loop and screen refresh. While recording or
+ * replaying, the clock only advances between game loops and when the screen is
+ * refreshed, so replaying the events in the same order reproduces the session
+ * exactly, independent of how fast it is replayed.
+ * Sound playback is not part of the recording, so sessions should be recorded
+ * without sound if they are to be replayed exactly. */
+namespace InputReplay
+{
+	// Both throw if the file cannot be opened or is not a recording
+	void StartRecording(const ST::string& path);
+	void StartReplay(const ST::string& path);
+	// Write out the rest of the recording, if any
+	void Stop();
+
+	bool IsRecording();
+	bool IsReplaying();
+
+	/* Returns the seed to initialize the random number generator with: the
+	 * fresh seed, which is recorded, or the seed of the replayed session. */
+	RandomSeed TakeRandomSeed(RandomSeed const& fresh);
+
+	/* Replaces SDL_PollEvent() in the main loop. When replaying, the events
+	 * come from the recording and SDL events other than SDL_QUIT are dropped.
+	 * Returns false when it is time for the next game loop. */
+	bool PollEvent(SDL_Event& event);
+
+	// Called before every game loop, advances the clock
+	void BeginGameLoop();
+
+	/* Called on every screen refresh, advances the clock, so transitions which
+	 * wait for the clock inside a single game loop come to an end. */
+	void AdvanceClock();
+
+	/* Replaces reading SDL_GetKeyboardState() while handling an event, the
+	 * state is recorded, respectively taken from the recording. */
+	bool IsKeyPressed(SDL_Scancode key);
+}
@@ -31,7 +31,8 @@ template<typename... Args>
 constexpr void LogMessageST(bool isAssert, LogLevel level, const char* file, Args... args)
 {
 	if (level <= Logger_getLevel()) {
-		Logger_log(level, ST::format(args...).c_str(), file);
+		ST::string const message{ ST::format(args...) };
+		Logger_log(level, toRStrView(message), file);
 	}
 
 	#ifdef ENABLE_ASSERTS
@@ -36,18 +36,25 @@ struct PreRandomEngine {
 };
 static PreRandomEngine gPreRandomEngine;
 
-void InitializeRandom(void)
+RandomSeed MakeRandomSeed()
 {
+	RandomSeed seed;
+
 	// Seed the pseudo-random number engine with the current time
 	// so that the numbers will be different every time we run.
-	UINT32 uiSeed1 = std::chrono::system_clock::now().time_since_epoch().count();
+	seed.uiTime = std::chrono::system_clock::now().time_since_epoch().count();
 
 	// Also try to seed the pseudo-random number engine with a non-deterministic
 	// random number (entropy is 0 when not available).
 	std::random_device randomDevice;
-	UINT32 uiSeed2 = guiDistribution(randomDevice);
+	seed.uiEntropy = guiDistribution(randomDevice);
+
+	return seed;
+}
 
-	std::seed_seq seed = { uiSeed1, uiSeed2 };
+void InitializeRandom(RandomSeed const& s)
+{
+	std::seed_seq seed = { s.uiTime, s.uiEntropy };
 	gRandomEngine.seed(seed);
 
 	// Pregenerate random numbers.
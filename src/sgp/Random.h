@@ -5,7 +5,16 @@
 #include <random>
 
 
-extern void InitializeRandom(void);
+// The values the random number engine is seeded with
+struct RandomSeed
+{
+	UINT32 uiTime;
+	UINT32 uiEntropy;
+};
+
+// A seed that differs every time the game is run
+RandomSeed MakeRandomSeed();
+extern void InitializeRandom(RandomSeed const&);
 extern UINT32 Random( UINT32 uiRange );
 
 // Returns true 50% of the time, false 50% of the time.
@@ -0,0 +1,45 @@
+#include "ResourceCache.h"
+
+#include <algorithm>
+
+
+static std::vector<ResourceCacheBase const*>& Registry()
+{
+	// Function local, so caches with static storage can register themselves
+	static std::vector<ResourceCacheBase const*> caches;
+	return caches;
+}
+
+
+ResourceCacheBase::ResourceCacheBase(char const* const name, size_t const budget) :
+	m_name{ name },
+	m_budget{ budget }
+{
+	Registry().push_back(this);
+}
+
+
+ResourceCacheBase::~ResourceCacheBase()
+{
+	auto& caches = Registry();
+	caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+
+ResourceCacheStats ResourceCacheBase::stats() const
+{
+	return ResourceCacheStats{ m_name, 0, 0, m_bytes, m_budget, m_hits, m_misses, m_evictions };
+}
+
+
+void ResourceCacheBase::setBudget(size_t const budget)
+{
+	m_budget = budget;
+	trim();
+}
+
+
+std::vector<ResourceCacheBase const*> const& ResourceCacheBase::all()
+{
+	return Registry();
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+// Memory statistics of a resource cache, as shown on the debug pages
+struct ResourceCacheStats
+{
+	char const*   name;
+	size_t        entries;
+	size_t        pinned;
+	size_t        bytes;
+	size_t        budget;
+	std::uint32_t hits;
+	std::uint32_t misses;
+	std::uint32_t evictions;
+};
+
+
+/**
+ * @brief Bookkeeping shared by all resource caches
+ *
+ * Every cache registers itself on construction, so memory usage can be
+ * inspected without knowing about the individual caches.
+ */
+class ResourceCacheBase
+{
+public:
+	ResourceCacheBase(char const* name, size_t budget);
+	virtual ~ResourceCacheBase();
+
+	ResourceCacheBase(ResourceCacheBase const&) = delete;
+	ResourceCacheBase& operator=(ResourceCacheBase const&) = delete;
+
+	[[nodiscard]] virtual ResourceCacheStats stats() const;
+
+	// Change the byte budget, evicting entries right away if it shrinks
+	void setBudget(size_t budget);
+
+	// All caches that currently exist, in the order they were created
+	static std::vector<ResourceCacheBase const*> const& all();
+
+protected:
+	// Evict least recently used entries until the budget is met
+	virtual void trim() = 0;
+
+	char const*   m_name;
+	size_t        m_budget;
+	size_t        m_bytes{0};
+	std::uint32_t m_hits{0};
+	std::uint32_t m_misses{0};
+	std::uint32_t m_evictions{0};
+};
+
+
+/**
+ * @brief Keyed cache with a byte budget and least recently used eviction
+ *
+ * Each entry carries the number of bytes it accounts for. Inserting or
+ * growing an entry evicts the least recently used entries until the total
+ * is within the budget again. Pinned entries are never evicted, pins are
+ * counted so they can be nested. An entry that was just inserted or resized
+ * is not evicted either, so a single entry larger than the budget stays
+ * until something else is needed.
+ *
+ * The evictor is called for every entry that leaves the cache through
+ * eviction, erase() or clear(), but not on destruction: owners of resources
+ * that need an explicit release must clear() the cache while they still can.
+ */
+template<typename Key, typename Value>
+class ResourceCache : public ResourceCacheBase
+{
+public:
+	using Evictor = std::function<void(Key const&, Value&)>;
+
+	ResourceCache(char const* name, size_t budget, Evictor evictor = {}) :
+		ResourceCacheBase(name, budget),
+		m_evictor(std::move(evictor))
+	{}
+
+	// Look up an entry and mark it as most recently used, nullptr if not cached
+	Value* find(Key const& key)
+	{
+		auto const it = m_index.find(key);
+		if (it == m_index.end())
+		{
+			++m_misses;
+			return nullptr;
+		}
+		++m_hits;
+		m_lru.splice(m_lru.begin(), m_lru, it->second);
+		return &it->second->value;
+	}
+
+	// Look up an entry without touching the usage order or the statistics
+	Value* peek(Key const& key)
+	{
+		auto const it = m_index.find(key);
+		return it != m_index.end() ? &it->second->value : nullptr;
+	}
+
+	// Add or replace an entry, a replaced value is handed to the evictor
+	Value& insert(Key const& key, Value value, size_t bytes)
+	{
+		auto const it = m_index.find(key);
+		if (it != m_index.end())
+		{
+			Entry& e = *it->second;
+			if (m_evictor) m_evictor(e.key, e.value);
+			e.value = std::move(value);
+			m_bytes = m_bytes - e.bytes + bytes;
+			e.bytes = bytes;
+			m_lru.splice(m_lru.begin(), m_lru, it->second);
+		}
+		else
+		{
+			m_lru.push_front(Entry{ key, std::move(value), bytes, 0 });
+			m_index.emplace(key, m_lru.begin());
+			m_bytes += bytes;
+		}
+		trim();
+		return m_lru.front().value;
+	}
+
+	// Update the size of an entry that grew or shrank since it was inserted
+	void resize(Key const& key, size_t bytes)
+	{
+		auto const it = m_index.find(key);
+		if (it == m_index.end()) return;
+
+		Entry& e = *it->second;
+		m_bytes = m_bytes - e.bytes + bytes;
+		e.bytes = bytes;
+		m_lru.splice(m_lru.begin(), m_lru, it->second);
+		trim();
+	}
+
+	// Protect an entry from eviction until the matching unpin()
+	bool pin(Key const& key)
+	{
+		auto const it = m_index.find(key);
+		if (it == m_index.end()) return false;
+		if (it->second->pins++ == 0) ++m_pinned;
+		return true;
+	}
+
+	void unpin(Key const& key)
+	{
+		auto const it = m_index.find(key);
+		if (it == m_index.end() || it->second->pins == 0) return;
+		if (--it->second->pins == 0)
+		{
+			--m_pinned;
+			trim();
+		}
+	}
+
+	// Remove an entry, pinned or not
+	bool erase(Key const& key)
+	{
+		auto const it = m_index.find(key);
+		if (it == m_index.end()) return false;
+		remove(it->second);
+		return true;
+	}
+
+	// Remove all entries, pinned or not
+	void clear()
+	{
+		while (!m_lru.empty()) remove(std::prev(m_lru.end()));
+	}
+
+	[[nodiscard]] size_t size() const { return m_index.size(); }
+	[[nodiscard]] size_t bytes() const { return m_bytes; }
+
+	[[nodiscard]] ResourceCacheStats stats() const override
+	{
+		ResourceCacheStats s = ResourceCacheBase::stats();
+		s.entries = m_index.size();
+		s.pinned  = m_pinned;
+		return s;
+	}
+
+protected:
+	void trim() override
+	{
+		if (m_bytes <= m_budget || m_lru.size() < 2) return;
+
+		// Walk from the least recently used end, but never evict the front
+		// entry: it is the one that was just added or touched.
+		auto it = std::prev(m_lru.end());
+		while (m_bytes > m_budget && it != m_lru.begin())
+		{
+			auto const victim = it--;
+			if (victim->pins != 0) continue;
+			remove(victim);
+			++m_evictions;
+		}
+	}
+
+private:
+	struct Entry
+	{
+		Key    key;
+		Value  value;
+		size_t bytes;
+		size_t pins;
+	};
+
+	using EntryList = std::list<Entry>;
+
+	void remove(typename EntryList::iterator const it)
+	{
+		if (it->pins != 0) --m_pinned;
+		m_bytes -= it->bytes;
+		m_index.erase(it->key);
+		if (m_evictor) m_evictor(it->key, it->value);
+		m_lru.erase(it);
+	}
+
+	// Most recently used first
+	EntryList m_lru;
+	std::map<Key, typename EntryList::iterator> m_index;
+	size_t m_pinned{0};
+	Evictor m_evictor;
+};
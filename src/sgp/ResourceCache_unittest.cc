@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+
+#include "ResourceCache.h"
+
+#include <string>
+
+
+TEST(ResourceCache, evictsLeastRecentlyUsed)
+{
+	std::vector<int> evicted;
+	ResourceCache<int, std::string> cache("test", 30, [&](int const& key, std::string&) { evicted.push_back(key); });
+
+	cache.insert(1, "one", 10);
+	cache.insert(2, "two", 10);
+	cache.insert(3, "three", 10);
+	ASSERT_NE(cache.find(1), nullptr);
+
+	cache.insert(4, "four", 10);
+	EXPECT_EQ(evicted, std::vector<int>{ 2 });
+	EXPECT_EQ(cache.find(2), nullptr);
+	EXPECT_EQ(*cache.find(1), "one");
+	EXPECT_EQ(cache.bytes(), 30u);
+
+	ResourceCacheStats const s = cache.stats();
+	EXPECT_EQ(s.entries, 3u);
+	EXPECT_EQ(s.hits, 2u);
+	EXPECT_EQ(s.misses, 1u);
+	EXPECT_EQ(s.evictions, 1u);
+}
+
+TEST(ResourceCache, pinnedEntriesStay)
+{
+	ResourceCache<int, int> cache("test", 20);
+
+	cache.insert(1, 1, 10);
+	cache.pin(1);
+	cache.pin(1);
+	cache.insert(2, 2, 10);
+	cache.insert(3, 3, 10);
+	EXPECT_NE(cache.peek(1), nullptr);
+	EXPECT_EQ(cache.peek(2), nullptr);
+
+	// a single entry over budget is kept until something else is needed
+	cache.resize(3, 40);
+	EXPECT_NE(cache.peek(1), nullptr);
+	EXPECT_NE(cache.peek(3), nullptr);
+	EXPECT_EQ(cache.stats().pinned, 1u);
+
+	cache.unpin(1);
+	EXPECT_NE(cache.peek(1), nullptr);
+	cache.unpin(1);
+	EXPECT_EQ(cache.peek(1), nullptr);
+	EXPECT_EQ(cache.bytes(), 40u);
+
+	cache.clear();
+	EXPECT_EQ(cache.size(), 0u);
+	EXPECT_EQ(cache.bytes(), 0u);
+}
+
+TEST(ResourceCache, registry)
+{
+	auto const before = ResourceCacheBase::all().size();
+	{
+		ResourceCache<int, int> cache("registered", 0);
+		ASSERT_EQ(ResourceCacheBase::all().size(), before + 1);
+		EXPECT_STREQ(ResourceCacheBase::all().back()->stats().name, "registered");
+	}
+	EXPECT_EQ(ResourceCacheBase::all().size(), before);
+}
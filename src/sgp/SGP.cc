@@ -1,3 +1,4 @@
+#include "BattleSimulator.h" // XXX should not be used in SGP
 #include "Button_System.h"
 #include "Cheats.h"
 #include "Debug.h"
@@ -7,12 +8,14 @@
 #include "GameLoop.h"
 #include "Init.h" // XXX should not be used in SGP
 #include "Input.h"
+#include "InputReplay.h"
 #include "Intro.h"
 #include "JA2_Splash.h"
 #include "Random.h"
 #include "SGP.h"
 #include "SaveLoadGame.h" // XXX should not be used in SGP
 #include "SoundMan.h"
+#include "Timer.h"
 #include "VObject.h"
 #include "Video.h"
 #include "VSurface.h"
@@ -64,6 +67,7 @@ extern BOOLEAN gfPauseDueToPlayerGamePause;
 ////////////////////////////////////////////////////////////////////////////
 
 static BOOLEAN gfGameInitialized = FALSE;
+static bool    s_runHeadless     = false;
 
 /** Deinitialize the game an exit. */
 static void shutdownGame()
@@ -81,6 +85,8 @@ static void shutdownGame()
 	ShutdownButtonSystem();
 	MSYS_Shutdown();
 
+	InputReplay::Stop();
+
 	SLOGD("Shutting Down Sound Manager");
 	ShutdownSoundManager();
 
@@ -129,7 +135,7 @@ static void MainLoop()
 		UpdateJA2Clock();
 
 		SDL_Event event;
-		if (SDL_PollEvent(&event))
+		if (InputReplay::PollEvent(event))
 		{
 			switch (event.type)
 			{
@@ -143,7 +149,7 @@ static void MainLoop()
 
 				case SDL_KEYDOWN:
 					if (event.key.keysym.sym == SDLK_f &&
-					    SDL_GetModState() & KMOD_CTRL)
+					    event.key.keysym.mod & KMOD_CTRL)
 					{
 						FPS::ToggleOnOff();
 					}
@@ -179,8 +185,12 @@ static void MainLoop()
 				// once every ~6944 microseconds.
 				constexpr auto targetResolution = 1'000'000us / 144;
 				auto const beforeGameLoop = std::chrono::steady_clock::now();
+				InputReplay::BeginGameLoop();
 				FPS::GameLoopPtr();
 
+				// A headless replay runs as fast as it can
+				if (s_runHeadless) continue;
+
 				// If the game loop took longer than 6944ms, this call does nothing.
 				std::this_thread::sleep_until(beforeGameLoop + targetResolution);
 			}
@@ -340,6 +350,15 @@ int main(int argc, char* argv[])
 			GameMode::getInstance()->setEditorMode(false);
 		}
 
+		RustPointer<char> recordFile(EngineOptions_getInputRecordFile(params.get()));
+		RustPointer<char> replayFile(EngineOptions_getInputReplayFile(params.get()));
+		RustPointer<char> battleSave(EngineOptions_getBattleSave(params.get()));
+		if (EngineOptions_shouldRunHeadless(params.get())) {
+			s_runHeadless = true;
+			SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+			SoundEnableSound(FALSE);
+		}
+
 		uint16_t width = EngineOptions_getResolutionX(params.get());
 		uint16_t height = EngineOptions_getResolutionY(params.get());
 		g_ui.setScreenSize(width, height);
@@ -371,6 +390,38 @@ int main(int argc, char* argv[])
 		freopen("CON", "w", stderr);
 	#endif
 
+		if (*recordFile) {
+			if (IsSoundEnabled()) {
+				SLOGW("Sound is not recorded, the recording may not replay exactly (use -nosound)");
+			}
+			InputReplay::StartRecording(recordFile.get());
+		} else if (*replayFile) {
+			InputReplay::StartReplay(replayFile.get());
+		}
+
+		SLOGD("Initializing Random");
+		// Initialize random number generator, a replay brings its own seed.
+		// This freezes the clock for a recorded session, so it comes before
+		// anything that reads the clock.
+		RandomSeed seed = MakeRandomSeed();
+		bool const fixedSeed = EngineOptions_hasRandomSeed(params.get());
+		if (fixedSeed) {
+			seed = RandomSeed{ EngineOptions_getRandomSeed(params.get()), 0 };
+		} else if (*battleSave) {
+			// A single number, so the battle can be repeated with -seed
+			seed = RandomSeed{ seed.uiTime ^ seed.uiEntropy, 0 };
+		}
+		InitializeRandom(InputReplay::TakeRandomSeed(seed)); // no Shutdown
+		if (fixedSeed || *battleSave) {
+			SLOGI("Random seed: {}", seed.uiTime);
+		}
+
+		if (*battleSave) {
+			// A simulated battle advances the clock itself, from the same start on every run
+			gfGameClockFrozen = true;
+			guiFrozenClock    = 1000;
+		}
+
 		SLOGD("Initializing Game Resources");
 
 		DefaultContentManager *cm;
@@ -416,16 +467,18 @@ int main(int argc, char* argv[])
 		SLOGD("Initializing Sound Manager");
 		InitializeSoundManager();
 
-		SLOGD("Initializing Random");
-		// Initialize random number generator
-		InitializeRandom(); // no Shutdown
-
 		SLOGD("Initializing Game Manager");
 		// Initialize the Game
 		InitializeGame();
 
 		gfGameInitialized = TRUE;
 
+		if (*battleSave) {
+			RunBattleSimulation(battleSave.get());
+			shutdownGame();
+			return EXIT_SUCCESS;
+		}
+
 		if(isEnglishVersion() || isChineseVersion())
 		{
 			SetIntroType(INTRO_SPLASH);
@@ -49,11 +49,14 @@
 #undef MINIAUDIO_IMPLEMENTATION
 
 /*
- * from\to FREE PLAY STOP DEAD
- *    FREE       M
- *    PLAY  2         M    C
- *    STOP  2              C
- *    DEAD  M         1
+ * from\to FREE READY PLAY STOP DEAD
+ *    FREE        M     M
+ *    READY 2           M    M
+ *    PLAY  2                M    C
+ *    STOP  2                     C
+ *    DEAD  M                1
+ *
+ * READY channels are filled by the buffer servicing thread, but not mixed
  *
  * M = Regular state transition done by main thread
  * C = Regular state transition done by sound callback
@@ -65,6 +68,7 @@
 enum
 {
 	CHANNEL_FREE,
+	CHANNEL_READY,
 	CHANNEL_PLAY,
 	CHANNEL_STOP,
 	CHANNEL_DEAD
@@ -140,8 +144,9 @@ struct SOUNDTAG
 	UINT32        uiTimeStamp;
 	HWFILE        hFile;
 	UINT32        uiFadeVolume;
-	UINT32        uiFadeRate;
-	UINT32        uiFadeTime;
+	UINT32        uiFadeTarget; // Volume at the end of a fade
+	UINT32        uiFadeFrames; // Frames left until the fade is complete, 0 if not fading
+	BOOLEAN       fFadeStop;    // Stop the sound once the fade is complete
 	UINT32        Loops;
 	UINT32        Pan;
 
@@ -218,8 +223,11 @@ void ShutdownSoundManager(void)
 
 
 static SOUNDTAG*  SoundGetFreeChannel(void);
+static SOUNDTAG*  SoundGetChannelByID(UINT32 uiSoundID);
 static SAMPLETAG* SoundLoadSample(const char* pFilename);
 static UINT32     SoundStartSample(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data);
+static UINT32     SoundSetupChannel(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data);
+static void       SoundRequestBufferService(void);
 
 
 UINT32 SoundPlay(const char* pFilename, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data)
@@ -235,6 +243,51 @@ UINT32 SoundPlay(const char* pFilename, UINT32 volume, UINT32 pan, UINT32 loop,
 	return SoundStartSample(sample, channel, volume, pan, loop, end_callback, data);
 }
 
+
+UINT32 SoundPrepare(const char* pFilename, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data)
+{
+	if (!fSoundSystemInit) return SOUND_ERROR;
+
+	SAMPLETAG* const sample = SoundLoadSample(pFilename);
+	if (sample == NULL) return SOUND_ERROR;
+
+	SOUNDTAG* const channel = SoundGetFreeChannel();
+	if (channel == NULL) return SOUND_ERROR;
+
+	UINT32 const uiSoundID = SoundSetupChannel(sample, channel, volume, pan, loop, end_callback, data);
+
+	// Decoding happens on the buffer servicing thread
+	channel->State = CHANNEL_READY;
+	SoundRequestBufferService();
+
+	return uiSoundID;
+}
+
+
+BOOLEAN SoundIsPrepared(UINT32 uiSoundID)
+{
+	if (!fSoundSystemInit) return FALSE;
+
+	SOUNDTAG* const channel = SoundGetChannelByID(uiSoundID);
+	if (channel == NULL || channel->State != CHANNEL_READY) return FALSE;
+
+	return channel->DoneServicing ||
+		ma_pcm_rb_available_read(channel->pRingBuffer) >= SOUND_RING_BUFFER_SIZE / 2;
+}
+
+
+BOOLEAN SoundStartPrepared(UINT32 uiSoundID)
+{
+	if (!fSoundSystemInit) return FALSE;
+
+	SOUNDTAG* const channel = SoundGetChannelByID(uiSoundID);
+	if (channel == NULL || channel->State != CHANNEL_READY) return FALSE;
+
+	channel->uiTimeStamp = GetClock();
+	channel->State       = CHANNEL_PLAY;
+	return TRUE;
+}
+
 static SAMPLETAG* SoundLoadBuffer(UINT8* buf, UINT32 bufSize, ma_format format, UINT32 channels, int freq);
 static BOOLEAN    SoundCleanCache(void);
 static SAMPLETAG* SoundGetEmptySample(void);
@@ -305,9 +358,6 @@ UINT32 SoundPlayRandom(const char* pFilename, UINT32 time_min, UINT32 time_max,
 }
 
 
-static SOUNDTAG* SoundGetChannelByID(UINT32 uiSoundID);
-
-
 BOOLEAN SoundIsPlaying(UINT32 uiSoundID)
 {
 	if (!fSoundSystemInit) return FALSE;
@@ -360,7 +410,28 @@ BOOLEAN SoundSetVolume(UINT32 uiSoundID, UINT32 uiVolume)
 	SOUNDTAG* const channel = SoundGetChannelByID(uiSoundID);
 	if (channel == NULL) return FALSE;
 
+	SDL_LockAudio();
 	channel->uiFadeVolume = std::min(uiVolume, UINT32(MAXVOLUME));
+	channel->uiFadeFrames = 0;
+	channel->fFadeStop    = FALSE;
+	SDL_UnlockAudio();
+	return TRUE;
+}
+
+
+BOOLEAN SoundFade(UINT32 uiSoundID, UINT32 uiVolume, UINT32 uiTime, BOOLEAN fStop)
+{
+	if (!fSoundSystemInit) return FALSE;
+
+	SOUNDTAG* const channel = SoundGetChannelByID(uiSoundID);
+	if (channel == NULL) return FALSE;
+
+	// The mixer ramps the volume per frame, see SoundCallback()
+	SDL_LockAudio();
+	channel->uiFadeTarget = std::min(uiVolume, UINT32(MAXVOLUME));
+	channel->uiFadeFrames = std::max(UINT32(1), uiTime * SOUND_FREQ / 1000);
+	channel->fFadeStop    = fStop;
+	SDL_UnlockAudio();
 	return TRUE;
 }
 
@@ -551,7 +622,7 @@ static int SoundServiceBuffers(void *_ptr)
 			for (UINT32 i = 0; i < lengthof(pSoundList); i++)
 			{
 				SOUNDTAG* Sound = &pSoundList[i];
-				if (Sound->State == CHANNEL_PLAY) {
+				if (Sound->State == CHANNEL_PLAY || Sound->State == CHANNEL_READY) {
 					FillRingBuffer(Sound);
 				}
 			}
@@ -897,6 +968,27 @@ static SOUNDTAG* SoundGetChannelByID(UINT32 uiSoundID)
 }
 
 
+// Mixes a channel while ramping its volume linearly towards the fade target
+static void MixFadingChannel(SOUNDTAG* Sound, const INT16* src, UINT32 samples)
+{
+	const INT    from   = Sound->uiFadeVolume;
+	const INT    to     = Sound->uiFadeTarget;
+	const UINT32 frames = Sound->uiFadeFrames;
+	for (UINT32 i = 0; i < samples; ++i)
+	{
+		const INT vol   = from + (to - from) * (INT)std::min(i + 1, frames) / (INT)frames;
+		const INT vol_l = vol * (127 - Sound->Pan) / MAXVOLUME;
+		const INT vol_r = vol * (  0 + Sound->Pan) / MAXVOLUME;
+		gMixBuffer[2 * i + 0] += src[2 * i + 0] * vol_l >> 7;
+		gMixBuffer[2 * i + 1] += src[2 * i + 1] * vol_r >> 7;
+	}
+
+	const UINT32 done = std::min(samples, frames);
+	Sound->uiFadeVolume = from + (to - from) * (INT)done / (INT)frames;
+	Sound->uiFadeFrames = frames - done;
+}
+
+
 static void SoundCallback(void* userdata, Uint8* stream, int len)
 {
 	if (len < 0)
@@ -923,6 +1015,7 @@ static void SoundCallback(void* userdata, Uint8* stream, int len)
 		{
 			default:
 			case CHANNEL_FREE:
+			case CHANNEL_READY:
 			case CHANNEL_DEAD:
 				continue;
 
@@ -932,8 +1025,6 @@ static void SoundCallback(void* userdata, Uint8* stream, int len)
 
 			case CHANNEL_PLAY:
 			{
-				const INT vol_l   = Sound->uiFadeVolume * (127 - Sound->Pan) / MAXVOLUME;
-				const INT vol_r   = Sound->uiFadeVolume * (  0 + Sound->Pan) / MAXVOLUME;
 				UINT32    samples = want_samples;
 				const INT16* src;
 				auto rbResult = ma_pcm_rb_acquire_read(Sound->pRingBuffer, &samples, (void**)&src);
@@ -942,16 +1033,28 @@ static void SoundCallback(void* userdata, Uint8* stream, int len)
 					continue;
 				}
 
-				for (UINT32 i = 0; i < samples; ++i)
+				if (Sound->uiFadeFrames == 0)
+				{
+					const INT vol_l = Sound->uiFadeVolume * (127 - Sound->Pan) / MAXVOLUME;
+					const INT vol_r = Sound->uiFadeVolume * (  0 + Sound->Pan) / MAXVOLUME;
+					for (UINT32 i = 0; i < samples; ++i)
+					{
+						gMixBuffer[2 * i + 0] += src[2 * i + 0] * vol_l >> 7;
+						gMixBuffer[2 * i + 1] += src[2 * i + 1] * vol_r >> 7;
+					}
+				}
+				else
 				{
-					gMixBuffer[2 * i + 0] += src[2 * i + 0] * vol_l >> 7;
-					gMixBuffer[2 * i + 1] += src[2 * i + 1] * vol_r >> 7;
+					MixFadingChannel(Sound, src, samples);
 				}
 
 				rbResult = ma_pcm_rb_commit_read(Sound->pRingBuffer, samples);
 				if (samples < want_samples || rbResult == MA_AT_END) {
 					Sound->State = CHANNEL_DEAD;
 				}
+				else if (Sound->uiFadeFrames == 0 && Sound->fFadeStop) {
+					Sound->State = CHANNEL_DEAD;
+				}
 
 				if (rbResult != MA_SUCCESS && rbResult != MA_AT_END) {
 					SLOGE("Could not commit read pointer for channel {}: {}", Sound - pSoundList, ma_result_description(rbResult));
@@ -1096,7 +1199,23 @@ static UINT32 SoundStartSample(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volu
 
 	if (!fSoundSystemInit) return SOUND_ERROR;
 
+	UINT32 const uiSoundID = SoundSetupChannel(sample, channel, volume, pan, loop, end_callback, data);
+
+	// Fill ring buffer with initial data
+	FillRingBuffer(channel);
+
+	channel->State        = CHANNEL_PLAY;
+
+	return uiSoundID;
+}
+
+
+// Assigns a sample to a channel without starting it
+static UINT32 SoundSetupChannel(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data)
+{
 	channel->uiFadeVolume  = volume;
+	channel->uiFadeFrames  = 0;
+	channel->fFadeStop     = FALSE;
 	channel->Loops         = loop;
 	channel->Pan           = pan;
 	channel->EOSCallback   = end_callback;
@@ -1111,10 +1230,6 @@ static UINT32 SoundStartSample(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volu
 
 	// Reset ring buffer
 	ma_pcm_rb_reset(channel->pRingBuffer);
-	// Fill ring buffer with initial data
-	FillRingBuffer(channel);
-
-	channel->State        = CHANNEL_PLAY;
 
 	sample->uiInstances++;
 	sample->uiCacheHits++;
@@ -1122,6 +1237,17 @@ static UINT32 SoundStartSample(SAMPLETAG* sample, SOUNDTAG* channel, UINT32 volu
 	return uiSoundID;
 }
 
+
+// Wakes up the buffer servicing thread
+static void SoundRequestBufferService(void)
+{
+	{
+		std::lock_guard<std::mutex> lk(mutexBuffersNeedService);
+		fBuffersNeedService = TRUE;
+	}
+	conditionBuffersNeedService.notify_one();
+}
+
 /* Returns a unique ID number with every call. Basically it's just a 32-bit
  * static value that is incremented each time. */
 static UINT32 SoundGetUniqueID(void)
@@ -34,6 +34,21 @@ UINT32 SoundPlayFromSmackBuff(const char* name, UINT8 channels, UINT8 depth, UIN
  */
 UINT32 SoundPlay(const char* pFilename, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data);
 
+/* Loads a sample and lets the stream servicing thread decode its beginning
+ * without playing it. The sound stays silent until it is started with
+ * SoundStartPrepared(), but can be stopped like any other sound.
+ *
+ * Returns: The sound ID if successful, SOUND_ERROR otherwise */
+UINT32 SoundPrepare(const char* pFilename, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data);
+
+// Returns TRUE once a prepared sound has enough data decoded to start without a gap.
+BOOLEAN SoundIsPrepared(UINT32 uiSoundID);
+
+/* Starts playing a prepared sound.
+ *
+ * Returns: TRUE if the sound was started, FALSE if it is not a prepared sound */
+BOOLEAN SoundStartPrepared(UINT32 uiSoundID);
+
 /* Registers a sample to be played randomly within the specified parameters.
  *
  * * Samples designated "random" are ALWAYS loaded into the cache, and locked
@@ -81,6 +96,13 @@ BOOLEAN SoundIsPlaying(UINT32 uiSoundID);
  *          sample had already expired or couldn't be found */
 BOOLEAN SoundSetVolume(UINT32 uiSoundID, UINT32 uiVolume);
 
+/* Changes the volume of a sound over uiTime milliseconds. The mixer ramps
+ * the volume per sample, if fStop is set the sound is stopped when the fade
+ * completes.
+ *
+ * Returns: TRUE if the fade was started, FALSE if the sound couldn't be found */
+BOOLEAN SoundFade(UINT32 uiSoundID, UINT32 uiVolume, UINT32 uiTime, BOOLEAN fStop);
+
 /* Sets the pan on a currently playing sound.
  *
  * Returns: TRUE if the pan was actually set on the sample, FALSE if the sample
@@ -4,9 +4,14 @@
 #include "Types.h"
 #include <SDL.h>
 
+// While a session is recorded or replayed, the clock only advances between game
+// loops and on screen refreshes
+extern bool   gfGameClockFrozen;
+extern UINT32 guiFrozenClock;
+
 static inline UINT32 GetClock(void)
 {
-	return SDL_GetTicks();
+	return gfGameClockFrozen ? guiFrozenClock : SDL_GetTicks();
 }
 
 #endif
@@ -14,6 +14,7 @@
 #include "UILayout.h"
 #include "Font.h"
 #include "Icon.h"
+#include "InputReplay.h"
 #include <algorithm>
 #include <chrono>
 #include <stdexcept>
@@ -51,7 +52,12 @@ static UINT32   guiDirtyRegionExCount;
 
 
 static SDL_Surface* MouseCursor;
+// The system cursor that is shown instead of drawing MouseCursor, if any
+static SDL_Cursor*  SystemCursor;
 static SDL_Surface* FrameBuffer;
+// Scratch copy of the part of the viewport which survives a scroll, SDL
+// can't blit overlapping regions of one surface onto itself
+static SDL_Surface* ScrollBuffer;
 static SDL_Renderer*  GameRenderer;
 SDL_Window* g_game_window;
 
@@ -222,6 +228,16 @@ void InitializeVideoManager(const VideoScaleQuality quality,
 		SLOGE("SDL_CreateRGBSurface for FrameBuffer failed: {}\n", SDL_GetError());
 	}
 
+	ScrollBuffer = SDL_CreateRGBSurface(
+		SDL_SWSURFACE, SCREEN_WIDTH, SCREEN_HEIGHT, PIXEL_DEPTH,
+		RED_MASK, GREEN_MASK, BLUE_MASK, ALPHA_MASK
+	);
+
+	if (ScrollBuffer == NULL)
+	{
+		SLOGE("SDL_CreateRGBSurface for ScrollBuffer failed: {}\n", SDL_GetError());
+	}
+
 	MouseCursor = SDL_CreateRGBSurface(
 		0, MAX_CURSOR_WIDTH, MAX_CURSOR_HEIGHT, PIXEL_DEPTH,
 		RED_MASK, GREEN_MASK, BLUE_MASK, ALPHA_MASK
@@ -252,6 +268,11 @@ void ShutdownVideoManager(void)
 	// ScreenBuffer SDL surface freed by its SGPVSurface wrapper.
 	ScreenBuffer = nullptr;
 
+	if (ScrollBuffer != NULL) {
+		SDL_FreeSurface(ScrollBuffer);
+		ScrollBuffer = NULL;
+	}
+
 	if (ScreenTexture != NULL) {
 		SDL_DestroyTexture(ScreenTexture);
 		ScreenTexture = NULL;
@@ -451,10 +472,13 @@ static void ScrollJA2Background(INT16 sScrollXIncrement, INT16 sScrollYIncrement
 #endif
 
 	{
-		SurfaceUniquePtr Source(SDL_CreateRGBSurfaceWithFormat(0,
-			ScreenBuffer->w, ScreenBuffer->h, 0, ScreenBuffer->format->format));
-		SDL_BlitSurface(ScreenBuffer, nullptr, Source.get(), nullptr);
-		SDL_BlitSurface(Source.get(), &SrcRect, Dest, &DstRect);
+		// Only the part which stays visible is moved, the exposed strips are
+		// rendered below. SDL_BlitSurface() clips its destination rect, so
+		// hand it copies.
+		SDL_Rect Kept = SrcRect;
+		SDL_BlitSurface(Dest, &SrcRect, ScrollBuffer, &Kept);
+		SDL_Rect Moved = DstRect;
+		SDL_BlitSurface(ScrollBuffer, &SrcRect, Dest, &Moved);
 	}
 
 	for (UINT i = 0; i < NumStrips; i++)
@@ -484,6 +508,8 @@ static void ScrollJA2Background(INT16 sScrollXIncrement, INT16 sScrollYIncrement
 
 void RefreshScreen(void)
 {
+	InputReplay::AdvanceClock();
+
 	// Not initialised yet or already shut down?
 	if (!ScreenTexture) return;
 
@@ -553,19 +579,26 @@ void RefreshScreen(void)
 		gfIgnoreScrollDueToCenterAdjust = FALSE;
 	}
 
-	SGPPoint cursorPos;
-	GetCursorPos(cursorPos);
-	SDL_Rect src;
-	src.x = 0;
-	src.y = 0;
-	src.w = gusMouseCursorWidth;
-	src.h = gusMouseCursorHeight + gsMouseSizeYModifier;
-	SDL_Rect dst;
-	dst.x = cursorPos.iX - gsMouseCursorXOffset;
-	dst.y = cursorPos.iY - gsMouseCursorYOffset;
-	SDL_BlitSurface(MouseCursor, &src, ScreenBuffer, &dst);
-	ScreenTextureUpdateRect += dst;
-	MouseBackground = dst;
+	if (SystemCursor)
+	{
+		MouseBackground = SDL_Rect{ 0, 0, 0, 0 };
+	}
+	else
+	{
+		SGPPoint cursorPos;
+		GetCursorPos(cursorPos);
+		SDL_Rect src;
+		src.x = 0;
+		src.y = 0;
+		src.w = gusMouseCursorWidth;
+		src.h = gusMouseCursorHeight + gsMouseSizeYModifier;
+		SDL_Rect dst;
+		dst.x = cursorPos.iX - gsMouseCursorXOffset;
+		dst.y = cursorPos.iY - gsMouseCursorYOffset;
+		SDL_BlitSurface(MouseCursor, &src, ScreenBuffer, &dst);
+		ScreenTextureUpdateRect += dst;
+		MouseBackground = dst;
+	}
 
 	uint8_t const * SrcPixels = static_cast<uint8_t *>(ScreenBuffer->pixels)
 		+ ScreenTextureUpdateRect.y * ScreenBuffer->pitch
@@ -622,6 +655,93 @@ void SetMouseCursorProperties(INT16 sOffsetX, INT16 sOffsetY, UINT16 usCursorHei
 }
 
 
+MouseCursorImage::~MouseCursorImage()
+{
+	if (!system_cursor) return;
+	if (SystemCursor == system_cursor) HideSystemMouseCursor();
+	SDL_FreeCursor(system_cursor);
+}
+
+
+std::unique_ptr<MouseCursorImage> SaveMouseCursorImage(UINT16 const w, UINT16 const h)
+{
+	auto cursor = std::make_unique<MouseCursorImage>();
+	cursor->image.reset(SDL_CreateRGBSurface(
+		0, std::max<UINT16>(w, 1), std::max<UINT16>(h, 1), PIXEL_DEPTH,
+		RED_MASK, GREEN_MASK, BLUE_MASK, ALPHA_MASK
+	));
+	if (!cursor->image) throw std::runtime_error("Failed to create SDL surface");
+	SDL_SetColorKey(cursor->image.get(), SDL_TRUE, 0);
+
+	// Copy the transparent pixels as well
+	SDL_SetColorKey(MouseCursor, SDL_FALSE, 0);
+	SDL_Rect src{ 0, 0, cursor->image->w, cursor->image->h };
+	SDL_BlitSurface(MouseCursor, &src, cursor->image.get(), nullptr);
+	SDL_SetColorKey(MouseCursor, SDL_TRUE, 0);
+	return cursor;
+}
+
+
+void RestoreMouseCursorImage(MouseCursorImage const& cursor)
+{
+	SDL_FillRect(MouseCursor, nullptr, 0);
+	SDL_BlitSurface(cursor.image.get(), nullptr, MouseCursor, nullptr);
+}
+
+
+bool ShowSystemMouseCursor(MouseCursorImage& cursor, INT16 const hot_x, INT16 const hot_y)
+{
+	// System cursors are not scaled with the screen
+	int w;
+	int h;
+	if (SDL_GetRendererOutputSize(GameRenderer, &w, &h) != 0 ||
+		w != SCREEN_WIDTH || h != SCREEN_HEIGHT)
+	{
+		return false;
+	}
+
+	if (cursor.system_cursor && (cursor.hot_x != hot_x || cursor.hot_y != hot_y))
+	{
+		if (SystemCursor == cursor.system_cursor) HideSystemMouseCursor();
+		SDL_FreeCursor(cursor.system_cursor);
+		cursor.system_cursor = nullptr;
+	}
+
+	if (!cursor.system_cursor)
+	{
+		if (cursor.system_cursor_failed) return false;
+
+		// The color key becomes the alpha channel
+		SurfaceUniquePtr const argb(SDL_ConvertSurfaceFormat(cursor.image.get(), SDL_PIXELFORMAT_ARGB8888, 0));
+		if (argb) cursor.system_cursor = SDL_CreateColorCursor(argb.get(), hot_x, hot_y);
+		if (!cursor.system_cursor)
+		{
+			SLOGW("Cannot create a system cursor, drawing it instead: {}", SDL_GetError());
+			cursor.system_cursor_failed = true;
+			return false;
+		}
+		cursor.hot_x = hot_x;
+		cursor.hot_y = hot_y;
+	}
+
+	if (SystemCursor != cursor.system_cursor)
+	{
+		SDL_SetCursor(cursor.system_cursor);
+		if (!SystemCursor) SDL_ShowCursor(SDL_ENABLE);
+		SystemCursor = cursor.system_cursor;
+	}
+	return true;
+}
+
+
+void HideSystemMouseCursor()
+{
+	if (!SystemCursor) return;
+	SDL_ShowCursor(SDL_DISABLE);
+	SystemCursor = nullptr;
+}
+
+
 static void SetPrimaryVideoSurfaces(void)
 {
 	// Delete surfaces if they exist
@@ -676,5 +796,7 @@ void HandleWindowEvent(SDL_Event const& evt)
 {
 	if (evt.window.event == SDL_WINDOWEVENT_RESIZED) {
 		SDL_RenderClear(GameRenderer);
+		// The screen may be scaled now, draw the cursor until it is set again
+		HideSystemMouseCursor();
 	}
 }
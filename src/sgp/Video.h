@@ -2,9 +2,13 @@
 #define VIDEO_H
 
 #include <SDL_events.h>
+#include <SDL_mouse.h>
 #include <SDL_video.h>
 #include "Types.h"
 #include "RustInterface.h"
+#include "VSurface.h"
+
+#include <memory>
 
 
 #define VIDEO_DEFAULT_TO_NO_CURSOR 0xFFFE // VIDEO_DEFAULT_TO_NO_CURSOR is equal to VIDEO_NO_CURSOR unless always_show_cursor_in_tactical is true
@@ -32,6 +36,32 @@ void HandleWindowEvent(SDL_Event const&);
 
 void SetMouseCursorProperties(INT16 sOffsetX, INT16 sOffsetY, UINT16 usCursorHeight, UINT16 usCursorWidth);
 
+/* A composed mouse cursor, kept to show it again without composing it. It
+ * can also be shown as system cursor, which the system draws on top of the
+ * screen, so moving the mouse does not touch the frame buffer. */
+struct MouseCursorImage
+{
+	SurfaceUniquePtr image;
+	SDL_Cursor*      system_cursor = nullptr;
+	bool             system_cursor_failed = false;
+	INT16            hot_x = 0;
+	INT16            hot_y = 0;
+
+	~MouseCursorImage();
+};
+
+// Copies the top left part of the mouse buffer
+std::unique_ptr<MouseCursorImage> SaveMouseCursorImage(UINT16 w, UINT16 h);
+// Clears the mouse buffer and copies the image back into it
+void RestoreMouseCursorImage(MouseCursorImage const&);
+
+/* Shows the image as system cursor instead of drawing the mouse buffer.
+ * Returns false if the platform cannot create the cursor or the screen is
+ * scaled, because system cursors are not. */
+bool ShowSystemMouseCursor(MouseCursorImage&, INT16 hot_x, INT16 hot_y);
+// Goes back to drawing the mouse buffer
+void HideSystemMouseCursor();
+
 void InvalidateRegionEx(INT32 iLeft, INT32 iTop, INT32 iRight, INT32 iBottom);
 
 void RefreshScreen(void);